@@ -0,0 +1,190 @@
+#ifndef BROADCAST_H
+#define BROADCAST_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// Рассылка поколений от одного писателя N читателям (N задается при
+// создании). Писатель ждет, пока все читатели обработают текущее
+// поколение, меняет данные и публикует следующее; каждый читатель
+// обрабатывает каждое поколение ровно один раз.
+//
+// Ожидание - через atomic::wait (futex в Linux) на двух 32-битных словах:
+// на номере поколения ждут читатели, на флаге "поколение еще не
+// обработано" - писатель; флаг он взводит до публикации поколения.
+//
+// Читатели отмечаются не в одном общем счетчике, а в дереве счетчиков
+// (combining tree) с ветвлением FAN_IN, каждый узел на своей кэш-линии.
+// Читатель уменьшает счетчик своего листа; последний пришедший в узел
+// заново взводит его на следующее поколение и поднимается к родителю.
+// Поэтому на один счетчик приходится не больше FAN_IN читателей, а путь
+// последнего читателя - O(log N) шагов. Последний пришедший в корень
+// снимает флаг и будит писателя. Читатель отмечается, только увидев
+// новое поколение, поэтому быстрый читатель не попадет в прошлое.
+//
+// Ограничение: публикация - один notify_all на слове поколения, и ядро
+// будит всех N ждущих читателей за этот вызов, так что время publish и
+// волна пробуждений растут с N линейно. Дерево убирает только общую
+// точку записи при отметке читателей.
+//
+// Писатель:                          Читатель:
+//     while (b.waitConsumed())           uint32_t seen = 0;
+//     {                                  while (b.await(seen))
+//         ... меняем данные ...          {
+//         b.publish();                       ... читаем данные ...
+//     }                                      b.consume(id);
+//                                        }
+// id - номер читателя от 0 до N-1, у каждого свой.
+// Читатель начинает с seen = 0, иначе он пропустит поколения,
+// опубликованные до его старта, и писатель их не дождется.
+// close() будит всех и завершает оба цикла.
+class Broadcast
+{
+private:
+    static constexpr uint32_t CLOSED = 1;           // Младший бит поколения
+    static constexpr uint32_t STEP = 2;
+    static constexpr uint32_t REMAINING_CLOSED = 1u << 31;
+    static constexpr int FAN_IN = 4;
+
+    // Узел дерева: сколько детей (читателей или узлов) еще не отметились
+    struct alignas(64) Node
+    {
+        std::atomic<uint32_t> pending{0};
+        uint32_t arity = 0;
+        int parent = -1;                            // -1 у корня
+    };
+
+    alignas(64) std::atomic<uint32_t> gen{0};       // (номер << 1) | CLOSED
+    alignas(64) std::atomic<uint32_t> remaining{0}; // 1, пока поколение не обработано | REMAINING_CLOSED
+    const uint32_t readers;
+    std::unique_ptr<Node[]> nodes;                  // Листья первыми, корень последним
+
+    static int levelSize(int children)
+    {
+        return (children + FAN_IN - 1) / FAN_IN;
+    }
+
+public:
+    explicit Broadcast(int readerCount) : readers(static_cast<uint32_t>(readerCount))
+    {
+        int total = 0;
+        for (int children = readerCount; ; children = levelSize(children))
+        {
+            total += levelSize(children);
+            if (levelSize(children) == 1)
+            {
+                break;
+            }
+        }
+        nodes = std::make_unique<Node[]>(total);
+
+        // Уровни лежат подряд: level - начало текущего уровня
+        int level = 0;
+        for (int children = readerCount; ; children = levelSize(children))
+        {
+            int size = levelSize(children);
+            for (int i = 0; i < size; i++)
+            {
+                Node& node = nodes[level + i];
+                node.arity = static_cast<uint32_t>(std::min(FAN_IN, children - i * FAN_IN));
+                node.pending.store(node.arity, std::memory_order_relaxed);
+                node.parent = size == 1 ? -1 : level + size + i / FAN_IN;
+            }
+            if (size == 1)
+            {
+                break;
+            }
+            level += size;
+        }
+    }
+
+    Broadcast(const Broadcast&) = delete;
+    Broadcast& operator=(const Broadcast&) = delete;
+
+    int readerCount() const { return static_cast<int>(readers); }
+
+    uint32_t generation() const
+    {
+        return gen.load(std::memory_order_acquire) & ~CLOSED;
+    }
+
+    // Писатель: ждет, пока все читатели обработают текущее поколение;
+    // false после close()
+    bool waitConsumed()
+    {
+        while (true)
+        {
+            uint32_t r = remaining.load(std::memory_order_acquire);
+            if ((r & REMAINING_CLOSED) != 0)
+            {
+                return false;
+            }
+            if (r == 0)
+            {
+                return true;
+            }
+            remaining.wait(r, std::memory_order_acquire);
+        }
+    }
+
+    // Писатель: публикует следующее поколение. Вызывать после waitConsumed
+    void publish()
+    {
+        // Флаг сейчас 0; fetch_add сохраняет бит закрытия, если close()
+        // уже был вызван
+        remaining.fetch_add(1, std::memory_order_relaxed);
+        gen.fetch_add(STEP, std::memory_order_release);
+        gen.notify_all();
+    }
+
+    // Читатель: ждет поколения новее seen и запоминает его в seen;
+    // false после close()
+    bool await(uint32_t& seen)
+    {
+        while (true)
+        {
+            uint32_t g = gen.load(std::memory_order_acquire);
+            if ((g & CLOSED) != 0)
+            {
+                return false;
+            }
+            if (g != seen)
+            {
+                seen = g;
+                return true;
+            }
+            gen.wait(g, std::memory_order_acquire);
+        }
+    }
+
+    // Читатель с номером reader из [0, readerCount()): поколение обработано
+    void consume(int reader)
+    {
+        for (int index = reader / FAN_IN; index >= 0; )
+        {
+            Node& node = nodes[index];
+            if (node.pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            {
+                return;
+            }
+            // Последний в узле: до следующего поколения сюда никто не придет
+            node.pending.store(node.arity, std::memory_order_relaxed);
+            index = node.parent;
+        }
+        remaining.fetch_sub(1, std::memory_order_acq_rel);
+        remaining.notify_one();
+    }
+
+    // Завершает рассылку: будит писателя и всех читателей
+    void close()
+    {
+        gen.fetch_or(CLOSED, std::memory_order_release);
+        gen.notify_all();
+        remaining.fetch_or(REMAINING_CLOSED, std::memory_order_release);
+        remaining.notify_all();
+    }
+};
+
+#endif
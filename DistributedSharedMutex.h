@@ -0,0 +1,132 @@
+#ifndef DISTRIBUTEDSHAREDMUTEX_H
+#define DISTRIBUTEDSHAREDMUTEX_H
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+// Распределенная блокировка читатель-писатель с интерфейсом std::shared_mutex.
+//
+// В std::shared_mutex все читатели меняют один общий счетчик, и его
+// кэш-линия гоняется между ядрами при каждом lock_shared/unlock_shared.
+// Здесь у каждого потока свой счетчик читателей в отдельной кэш-линии
+// (слоты раздаются потокам по кругу, при числе потоков больше SLOTS
+// слот делят несколько потоков). Читатель трогает только свой слот и
+// флаг писателя, который меняется лишь при записи.
+//
+// Писатель ставит флаг и ждет, пока опустеют все слоты, - запись стоит
+// O(SLOTS), зато стоимость чтения не растет с числом читателей. Новые
+// читатели при поднятом флаге отступают и ждут, поэтому писатель не
+// голодает (приоритет писателя). Писатели сериализуются мьютексом.
+//
+// Блокировка нерекурсивна; unlock_shared должен вызываться тем же
+// потоком, что и lock_shared.
+class DistributedSharedMutex
+{
+public:
+    static constexpr int SLOTS = 64;
+
+private:
+    struct alignas(64) ReaderSlot
+    {
+        std::atomic<int> readers{0};
+    };
+
+    ReaderSlot slots[SLOTS];
+    alignas(64) std::atomic<bool> writer{false};
+    std::mutex writerMtx;
+
+    static int slotIndex()
+    {
+        static std::atomic<int> nextSlot{0};
+        thread_local int index = nextSlot.fetch_add(1, std::memory_order_relaxed) % SLOTS;
+        return index;
+    }
+
+    bool readersDrained() const
+    {
+        for (const ReaderSlot& slot : slots)
+        {
+            if (slot.readers.load(std::memory_order_seq_cst) != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+public:
+    DistributedSharedMutex() = default;
+    DistributedSharedMutex(const DistributedSharedMutex&) = delete;
+    DistributedSharedMutex& operator=(const DistributedSharedMutex&) = delete;
+
+    void lock()
+    {
+        writerMtx.lock();
+        writer.store(true, std::memory_order_seq_cst);
+        while (!readersDrained())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    bool try_lock()
+    {
+        if (!writerMtx.try_lock())
+        {
+            return false;
+        }
+        writer.store(true, std::memory_order_seq_cst);
+        if (!readersDrained())
+        {
+            writer.store(false, std::memory_order_release);
+            writer.notify_all();
+            writerMtx.unlock();
+            return false;
+        }
+        return true;
+    }
+
+    void unlock()
+    {
+        writer.store(false, std::memory_order_release);
+        writer.notify_all();
+        writerMtx.unlock();
+    }
+
+    void lock_shared()
+    {
+        std::atomic<int>& readers = slots[slotIndex()].readers;
+        while (true)
+        {
+            // Сначала объявляемся, потом проверяем флаг; писатель делает
+            // наоборот, поэтому хотя бы один из двух увидит другого
+            readers.fetch_add(1, std::memory_order_seq_cst);
+            if (!writer.load(std::memory_order_seq_cst))
+            {
+                return;
+            }
+            readers.fetch_sub(1, std::memory_order_release);
+            writer.wait(true, std::memory_order_acquire);
+        }
+    }
+
+    bool try_lock_shared()
+    {
+        std::atomic<int>& readers = slots[slotIndex()].readers;
+        readers.fetch_add(1, std::memory_order_seq_cst);
+        if (!writer.load(std::memory_order_seq_cst))
+        {
+            return true;
+        }
+        readers.fetch_sub(1, std::memory_order_release);
+        return false;
+    }
+
+    void unlock_shared()
+    {
+        slots[slotIndex()].readers.fetch_sub(1, std::memory_order_release);
+    }
+};
+
+#endif
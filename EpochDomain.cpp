@@ -0,0 +1,189 @@
+#include "EpochDomain.h"
+#include <stdexcept>
+#include <thread>
+
+// Привязка потока к записи в домене. При завершении потока запись
+// освобождается, а его неосвобожденные узлы передаются домену
+struct EpochDomain::ThreadHandle
+{
+    ThreadRecord* record = nullptr;
+
+    ~ThreadHandle()
+    {
+        if (record != nullptr)
+        {
+            EpochDomain::instance().releaseRecord(record);
+        }
+    }
+};
+
+EpochDomain& EpochDomain::instance()
+{
+    static EpochDomain domain;
+    return domain;
+}
+
+EpochDomain::~EpochDomain()
+{
+    // Все потоки уже завершены, поэтому освобождаем все без проверки эпох
+    for (int i = 0; i < MAX_THREADS; i++)
+    {
+        for (const Retired& r : records[i].limbo)
+        {
+            r.deleter(r.ptr);
+        }
+    }
+    for (const Retired& r : orphans)
+    {
+        r.deleter(r.ptr);
+    }
+}
+
+EpochDomain::ThreadRecord& EpochDomain::localRecord()
+{
+    thread_local ThreadHandle handle;
+    if (handle.record == nullptr)
+    {
+        handle.record = acquireRecord();
+    }
+    return *handle.record;
+}
+
+EpochDomain::ThreadRecord* EpochDomain::acquireRecord()
+{
+    for (int i = 0; i < MAX_THREADS; i++)
+    {
+        bool expected = false;
+        if (!records[i].inUse.load(std::memory_order_relaxed) &&
+            records[i].inUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+        {
+            int high = recordsHigh.load(std::memory_order_relaxed);
+            while (high < i + 1 &&
+                   !recordsHigh.compare_exchange_weak(high, i + 1, std::memory_order_release, std::memory_order_relaxed))
+            {
+            }
+            return &records[i];
+        }
+    }
+    throw std::runtime_error("EpochDomain: too many threads");
+}
+
+void EpochDomain::releaseRecord(ThreadRecord* record)
+{
+    if (!record->limbo.empty())
+    {
+        std::lock_guard<std::mutex> lock(orphansMtx);
+        orphans.insert(orphans.end(), record->limbo.begin(), record->limbo.end());
+        record->limbo.clear();
+    }
+    record->nesting = 0;
+    record->announce.store(0, std::memory_order_release);
+    record->inUse.store(false, std::memory_order_release);
+}
+
+void EpochDomain::enter()
+{
+    ThreadRecord& record = localRecord();
+    if (record.nesting++ == 0)
+    {
+        uint64_t e = globalEpoch.load(std::memory_order_relaxed);
+        record.announce.store((e << 1) | ACTIVE, std::memory_order_relaxed);
+        // Объявление должно стать видимым до первого чтения узлов
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+void EpochDomain::leave()
+{
+    ThreadRecord& record = localRecord();
+    if (--record.nesting == 0)
+    {
+        record.announce.store(0, std::memory_order_release);
+    }
+}
+
+bool EpochDomain::tryAdvance()
+{
+    uint64_t e = globalEpoch.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    int high = recordsHigh.load(std::memory_order_acquire);
+    for (int i = 0; i < high; i++)
+    {
+        // acquire: чтения узлов читателем до leave() должны предшествовать
+        // освобождению, которое станет возможным после продвижения
+        uint64_t a = records[i].announce.load(std::memory_order_acquire);
+        if ((a & ACTIVE) != 0 && (a >> 1) != e)
+        {
+            return false;   // Кто-то еще работает в старой эпохе
+        }
+    }
+    return globalEpoch.compare_exchange_strong(e, e + 1, std::memory_order_acq_rel, std::memory_order_relaxed);
+}
+
+void EpochDomain::collect(std::vector<Retired>& list, uint64_t current)
+{
+    size_t kept = 0;
+    for (size_t i = 0; i < list.size(); i++)
+    {
+        if (list[i].epoch + 2 <= current)
+        {
+            list[i].deleter(list[i].ptr);
+            freed.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            list[kept++] = list[i];
+        }
+    }
+    list.resize(kept);
+}
+
+void EpochDomain::retire(void* ptr, void (*deleter)(void*))
+{
+    ThreadRecord& record = localRecord();
+    // Эпоха читается после того, как узел уже недостижим из структуры
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    record.limbo.push_back({ptr, deleter, globalEpoch.load(std::memory_order_relaxed)});
+    retired.fetch_add(1, std::memory_order_relaxed);
+
+    if (record.limbo.size() >= RETIRE_THRESHOLD)
+    {
+        tryAdvance();
+        uint64_t current = globalEpoch.load(std::memory_order_acquire);
+        collect(record.limbo, current);
+
+        std::unique_lock<std::mutex> lock(orphansMtx, std::try_to_lock);
+        if (lock.owns_lock() && !orphans.empty())
+        {
+            collect(orphans, current);
+        }
+    }
+}
+
+void EpochDomain::synchronize()
+{
+    // Когда эпоха уйдет на три шага вперед, все удаленное до вызова старше
+    // ее минимум на две. Продвижение не удается, пока кто-то закреплен в
+    // старой эпохе, - ждем, пока такие потоки выйдут. Если закреплен сам
+    // вызывающий поток, он никогда не выйдет, и освобождение выполняется
+    // по возможности
+    bool selfPinned = localRecord().nesting > 0;
+    uint64_t target = globalEpoch.load(std::memory_order_acquire) + 3;
+    while (globalEpoch.load(std::memory_order_acquire) < target)
+    {
+        if (!tryAdvance())
+        {
+            if (selfPinned)
+            {
+                break;
+            }
+            std::this_thread::yield();
+        }
+    }
+    uint64_t current = globalEpoch.load(std::memory_order_acquire);
+    collect(localRecord().limbo, current);
+
+    std::lock_guard<std::mutex> lock(orphansMtx);
+    collect(orphans, current);
+}
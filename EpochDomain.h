@@ -0,0 +1,128 @@
+#ifndef EPOCHDOMAIN_H
+#define EPOCHDOMAIN_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// Epoch-based reclamation (EBR) для узловых контейнеров.
+//
+// Поток перед обращением к разделяемым узлам "закрепляется" (pin) и
+// объявляет текущую глобальную эпоху. Удаленный из структуры узел не
+// освобождается сразу, а попадает в retire-список потока с номером эпохи.
+// Глобальная эпоха продвигается, только когда все закрепленные потоки ее
+// увидели, а узел освобождается через две эпохи после удаления - к этому
+// моменту ни один поток уже не может держать на него ссылку.
+//
+// Пример:
+//     auto guard = EpochDomain::instance().pin();
+//     ... читаем узлы ...
+//     EpochDomain::instance().retire(node);
+class EpochDomain
+{
+public:
+    static constexpr int MAX_THREADS = 256;
+    static constexpr size_t RETIRE_THRESHOLD = 64;   // Размер пачки до попытки освобождения
+
+    class Guard
+    {
+    private:
+        EpochDomain* domain;
+    public:
+        explicit Guard(EpochDomain* d) : domain(d) { domain->enter(); }
+        ~Guard() { if (domain) domain->leave(); }
+        Guard(Guard&& other) noexcept : domain(other.domain) { other.domain = nullptr; }
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+        Guard& operator=(Guard&&) = delete;
+    };
+
+    static EpochDomain& instance();
+
+    Guard pin() { return Guard(this); }
+
+    template<typename T>
+    void retire(T* ptr)
+    {
+        retire(ptr, [](void* p) { delete static_cast<T*>(p); });
+    }
+    void retire(void* ptr, void (*deleter)(void*));
+
+    // Ждет, пока закрепленные потоки выйдут из старых эпох, и освобождает
+    // все удаленное до вызова из retire-списка вызывающего потока и
+    // списков завершившихся потоков. Вызванный под pin() не ждет и
+    // освобождает только то, что уже можно
+    void synchronize();
+
+    uint64_t epoch() const { return globalEpoch.load(std::memory_order_relaxed); }
+    uint64_t retiredCount() const { return retired.load(std::memory_order_relaxed); }
+    uint64_t freedCount() const { return freed.load(std::memory_order_relaxed); }
+    uint64_t pendingCount() const { return retiredCount() - freedCount(); }
+
+    ~EpochDomain();
+
+private:
+    struct Retired
+    {
+        void* ptr;
+        void (*deleter)(void*);
+        uint64_t epoch;
+    };
+
+    static constexpr uint64_t ACTIVE = 1;          // Младший бит объявления: поток закреплен
+
+    struct alignas(64) ThreadRecord
+    {
+        std::atomic<uint64_t> announce{0};         // (эпоха << 1) | ACTIVE
+        std::atomic<bool> inUse{false};
+        int nesting = 0;                           // Вложенные pin() одного потока
+        std::vector<Retired> limbo;                // Принадлежит только потоку-владельцу
+    };
+
+    struct ThreadHandle;
+    friend struct ThreadHandle;
+
+    alignas(64) std::atomic<uint64_t> globalEpoch{2};
+    alignas(64) std::atomic<int> recordsHigh{0};
+    std::atomic<uint64_t> retired{0};
+    std::atomic<uint64_t> freed{0};
+    ThreadRecord records[MAX_THREADS];
+
+    std::mutex orphansMtx;                         // Retire-списки завершившихся потоков
+    std::vector<Retired> orphans;
+
+    EpochDomain() = default;
+
+    ThreadRecord& localRecord();
+    ThreadRecord* acquireRecord();
+    void releaseRecord(ThreadRecord* record);
+
+    void enter();
+    void leave();
+    bool tryAdvance();
+    void collect(std::vector<Retired>& list, uint64_t safeEpoch);
+};
+
+// Политика освобождения для контейнеров, параметризованных схемой reclamation
+// (см. LockFreeList). Пока Guard жив, ни один прочитанный узел не освободится,
+// поэтому отдельная защита и перепроверка указателей не нужны
+struct EpochReclaimer
+{
+    static constexpr bool NEEDS_VALIDATION = false;
+
+    class Guard
+    {
+    private:
+        EpochDomain::Guard guard;
+    public:
+        Guard() : guard(EpochDomain::instance().pin()) {}
+        void protect(int, void*) {}
+    };
+
+    template<typename T>
+    static void retire(T* ptr) { EpochDomain::instance().retire(ptr); }
+    static EpochDomain& domain() { return EpochDomain::instance(); }
+};
+
+#endif
@@ -0,0 +1,146 @@
+#include "FineGrainedList.h"
+#include <iostream>
+#include <vector>
+
+FineGrainedList::FineGrainedList() : head(0) {}
+
+FineGrainedList::~FineGrainedList()
+{
+    Node* current = head.next;
+    while (current != nullptr)
+    {
+        Node* next = current->next;
+        delete current;
+        current = next;
+    }
+}
+
+void FineGrainedList::insertAfterLocked(Node* node, int value)
+{
+    Node* newNode = new Node(value);
+    newNode->next = node->next;
+    node->next = newNode;
+    count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FineGrainedList::insert(int value)
+{
+    std::lock_guard<std::mutex> lock(head.mtx);
+    insertAfterLocked(&head, value);
+}
+
+void FineGrainedList::insertAfter(int targetValue, int newValue)
+{
+    // Идем по списку, держа не более двух соседних блокировок:
+    // следующий узел захватывается до освобождения текущего
+    std::unique_lock<std::mutex> prevLock(head.mtx);
+    Node* current = head.next;
+    while (current != nullptr)
+    {
+        std::unique_lock<std::mutex> currLock(current->mtx);
+        prevLock.unlock();
+
+        if (current->value == targetValue)
+        {
+            insertAfterLocked(current, newValue);
+            return;
+        }
+
+        prevLock = std::move(currLock);
+        current = current->next;
+    }
+    prevLock.unlock();
+
+    // Если target не найден, вставляем в начало. В отличие от LinkedList
+    // это отдельная операция: между обходом и вставкой target мог появиться
+    insert(newValue);
+}
+
+bool FineGrainedList::remove(int value)
+{
+    std::unique_lock<std::mutex> prevLock(head.mtx);
+    Node* prev = &head;
+    Node* current = head.next;
+    while (current != nullptr)
+    {
+        std::unique_lock<std::mutex> currLock(current->mtx);
+
+        if (current->value == value)
+        {
+            prev->next = current->next;
+            count.fetch_sub(1, std::memory_order_relaxed);
+
+            // Дойти до current можно только через prev, который мы держим,
+            // поэтому после снятия блокировки узел никому не виден
+            currLock.unlock();
+            delete current;
+            return true;
+        }
+
+        prevLock = std::move(currLock);
+        prev = current;
+        current = current->next;
+    }
+    return false;
+}
+
+bool FineGrainedList::find(int value)
+{
+    std::unique_lock<std::mutex> prevLock(head.mtx);
+    Node* current = head.next;
+    while (current != nullptr)
+    {
+        std::unique_lock<std::mutex> currLock(current->mtx);
+        prevLock.unlock();
+
+        if (current->value == value)
+        {
+            return true;
+        }
+
+        prevLock = std::move(currLock);
+        current = current->next;
+    }
+    return false;
+}
+
+void FineGrainedList::print() const
+{
+    // Собираем значения под блокировками, а в std::cout пишем уже без них,
+    // чтобы вывод в терминал не тормозил писателей
+    std::vector<int> values;
+    {
+        std::unique_lock<std::mutex> prevLock(head.mtx);
+        Node* current = head.next;
+        while (current != nullptr)
+        {
+            std::unique_lock<std::mutex> currLock(current->mtx);
+            prevLock.unlock();
+            values.push_back(current->value);
+            prevLock = std::move(currLock);
+            current = current->next;
+        }
+    }
+
+    std::cout << "List: ";
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        std::cout << values[i];
+        if (i + 1 < values.size())
+        {
+            std::cout << " -> ";
+        }
+    }
+    std::cout << " -> NULL" << std::endl;
+}
+
+int FineGrainedList::size() const
+{
+    return count.load(std::memory_order_relaxed);
+}
+
+bool FineGrainedList::empty() const
+{
+    std::lock_guard<std::mutex> lock(head.mtx);
+    return head.next == nullptr;
+}
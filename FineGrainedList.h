@@ -0,0 +1,40 @@
+#ifndef FINEGRAINEDLIST_H
+#define FINEGRAINEDLIST_H
+
+#include <mutex>
+#include <atomic>
+
+// Список с блокировкой на каждом узле (hand-over-hand / lock coupling).
+// Публичный API совпадает с LinkedList, поэтому ListTester в Task4
+// может работать с любым из двух вариантов.
+class FineGrainedList
+{
+private:
+    struct Node
+    {
+        int value;
+        Node* next;
+        mutable std::mutex mtx;
+        Node(int val) : value(val), next(nullptr) {}
+    };
+
+    Node head;                  // Фиктивный узел: его mtx защищает head.next
+    std::atomic<int> count{0};
+
+    void insertAfterLocked(Node* node, int value); // node должен быть захвачен
+
+public:
+    FineGrainedList();
+    ~FineGrainedList();
+
+    void insert(int value);                    // Вставка в начало
+    void insertAfter(int targetValue, int newValue); // Вставка после target
+    bool remove(int value);                    // Удаление по значению
+    bool find(int value);                      // Поиск элемента
+
+    void print() const;                        // Вывод списка
+    int size() const;                          // Размер списка
+    bool empty() const;                        // Проверка на пустоту
+};
+
+#endif
@@ -0,0 +1,169 @@
+#include "HazardDomain.h"
+#include <algorithm>
+#include <stdexcept>
+
+// Привязка потока к записи в домене. При завершении потока запись
+// освобождается, а его неосвобожденные узлы передаются домену
+struct HazardDomain::ThreadHandle
+{
+    ThreadRecord* record = nullptr;
+
+    ~ThreadHandle()
+    {
+        if (record != nullptr)
+        {
+            HazardDomain::instance().releaseRecord(record);
+        }
+    }
+};
+
+HazardDomain& HazardDomain::instance()
+{
+    static HazardDomain domain;
+    return domain;
+}
+
+HazardDomain::~HazardDomain()
+{
+    for (int i = 0; i < MAX_THREADS; i++)
+    {
+        for (const Retired& r : records[i].retiredList)
+        {
+            r.deleter(r.ptr);
+        }
+    }
+    for (const Retired& r : orphans)
+    {
+        r.deleter(r.ptr);
+    }
+}
+
+HazardDomain::Guard::Guard(HazardDomain* d) : domain(d), slots(d->localRecord().hazards) {}
+
+HazardDomain::Guard::~Guard()
+{
+    for (int i = 0; i < SLOTS; i++)
+    {
+        slots[i].store(nullptr, std::memory_order_release);
+    }
+}
+
+HazardDomain::ThreadRecord& HazardDomain::localRecord()
+{
+    thread_local ThreadHandle handle;
+    if (handle.record == nullptr)
+    {
+        handle.record = acquireRecord();
+    }
+    return *handle.record;
+}
+
+HazardDomain::ThreadRecord* HazardDomain::acquireRecord()
+{
+    for (int i = 0; i < MAX_THREADS; i++)
+    {
+        bool expected = false;
+        if (!records[i].inUse.load(std::memory_order_relaxed) &&
+            records[i].inUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+        {
+            int high = recordsHigh.load(std::memory_order_relaxed);
+            while (high < i + 1 &&
+                   !recordsHigh.compare_exchange_weak(high, i + 1, std::memory_order_release, std::memory_order_relaxed))
+            {
+            }
+            return &records[i];
+        }
+    }
+    throw std::runtime_error("HazardDomain: too many threads");
+}
+
+void HazardDomain::releaseRecord(ThreadRecord* record)
+{
+    for (int i = 0; i < SLOTS; i++)
+    {
+        record->hazards[i].store(nullptr, std::memory_order_release);
+    }
+    if (!record->retiredList.empty())
+    {
+        std::lock_guard<std::mutex> lock(orphansMtx);
+        orphans.insert(orphans.end(), record->retiredList.begin(), record->retiredList.end());
+        record->retiredList.clear();
+    }
+    record->inUse.store(false, std::memory_order_release);
+}
+
+size_t HazardDomain::scanThreshold() const
+{
+    // Порог вдвое больше числа возможных hazard pointers: после просмотра
+    // хотя бы половина списка гарантированно освобождается
+    size_t hazards = size_t(SLOTS) * recordsHigh.load(std::memory_order_relaxed);
+    return std::max<size_t>(64, 2 * hazards);
+}
+
+void HazardDomain::scan(std::vector<Retired>& list)
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    std::vector<void*> protectedPtrs;
+    int high = recordsHigh.load(std::memory_order_acquire);
+    protectedPtrs.reserve(size_t(high) * SLOTS);
+    for (int i = 0; i < high; i++)
+    {
+        for (int j = 0; j < SLOTS; j++)
+        {
+            void* p = records[i].hazards[j].load(std::memory_order_acquire);
+            if (p != nullptr)
+            {
+                protectedPtrs.push_back(p);
+            }
+        }
+    }
+    std::sort(protectedPtrs.begin(), protectedPtrs.end());
+
+    size_t kept = 0;
+    for (size_t i = 0; i < list.size(); i++)
+    {
+        if (std::binary_search(protectedPtrs.begin(), protectedPtrs.end(), list[i].ptr))
+        {
+            list[kept++] = list[i];
+        }
+        else
+        {
+            list[i].deleter(list[i].ptr);
+            freed.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    list.resize(kept);
+}
+
+void HazardDomain::retire(void* ptr, void (*deleter)(void*))
+{
+    ThreadRecord& record = localRecord();
+    record.retiredList.push_back({ptr, deleter});
+    retired.fetch_add(1, std::memory_order_relaxed);
+
+    size_t local = record.retiredList.size();
+    size_t seen = maxLocal.load(std::memory_order_relaxed);
+    while (local > seen && !maxLocal.compare_exchange_weak(seen, local, std::memory_order_relaxed))
+    {
+    }
+
+    if (local >= scanThreshold())
+    {
+        scan(record.retiredList);
+
+        std::unique_lock<std::mutex> lock(orphansMtx, std::try_to_lock);
+        if (lock.owns_lock() && !orphans.empty())
+        {
+            scan(orphans);
+        }
+    }
+}
+
+void HazardDomain::synchronize()
+{
+    scan(localRecord().retiredList);
+
+    std::lock_guard<std::mutex> lock(orphansMtx);
+    scan(orphans);
+}
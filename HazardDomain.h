@@ -0,0 +1,126 @@
+#ifndef HAZARDDOMAIN_H
+#define HAZARDDOMAIN_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// Hazard pointers - альтернатива EpochDomain с ограниченным объемом мусора.
+//
+// Поток публикует указатели на узлы, которые сейчас читает (до SLOTS штук),
+// и после публикации проверяет, что узел все еще достижим. Удаленный узел
+// попадает в retire-список потока; когда список дорастает до порога,
+// поток просматривает все опубликованные указатели и освобождает
+// незащищенные узлы. Защищенных узлов не больше SLOTS * число потоков,
+// поэтому в отличие от EBR остановившийся читатель удерживает лишь
+// несколько узлов, а retire-список потока не превышает RETIRE_CAP.
+class HazardDomain
+{
+public:
+    static constexpr int MAX_THREADS = 256;
+    static constexpr int SLOTS = 3;                            // Указателей на поток
+    static constexpr size_t RETIRE_CAP = 2 * SLOTS * MAX_THREADS;
+
+    // Слоты потока. Одновременно у потока может быть только один Guard
+    class Guard
+    {
+    private:
+        HazardDomain* domain;
+        std::atomic<void*>* slots;
+    public:
+        explicit Guard(HazardDomain* d);
+        ~Guard();
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+        // Публикует ptr в слоте slot. Вызывающий обязан затем убедиться,
+        // что ptr все еще достижим, иначе узел мог быть освобожден до публикации
+        void protect(int slot, void* ptr)
+        {
+            slots[slot].store(ptr, std::memory_order_seq_cst);
+        }
+        void clear(int slot)
+        {
+            slots[slot].store(nullptr, std::memory_order_release);
+        }
+    };
+
+    static HazardDomain& instance();
+
+    Guard pin() { return Guard(this); }
+
+    template<typename T>
+    void retire(T* ptr)
+    {
+        retire(ptr, [](void* p) { delete static_cast<T*>(p); });
+    }
+    void retire(void* ptr, void (*deleter)(void*));
+
+    // Просматривает hazard pointers и освобождает все незащищенные узлы
+    void synchronize();
+
+    uint64_t retiredCount() const { return retired.load(std::memory_order_relaxed); }
+    uint64_t freedCount() const { return freed.load(std::memory_order_relaxed); }
+    uint64_t pendingCount() const { return retiredCount() - freedCount(); }
+    size_t maxRetiredPerThread() const { return maxLocal.load(std::memory_order_relaxed); }
+
+    ~HazardDomain();
+
+private:
+    struct Retired
+    {
+        void* ptr;
+        void (*deleter)(void*);
+    };
+
+    struct alignas(64) ThreadRecord
+    {
+        std::atomic<void*> hazards[SLOTS] = {};
+        std::atomic<bool> inUse{false};
+        std::vector<Retired> retiredList;          // Принадлежит только потоку-владельцу
+    };
+
+    struct ThreadHandle;
+    friend struct ThreadHandle;
+
+    alignas(64) std::atomic<int> recordsHigh{0};
+    std::atomic<uint64_t> retired{0};
+    std::atomic<uint64_t> freed{0};
+    std::atomic<size_t> maxLocal{0};
+    ThreadRecord records[MAX_THREADS];
+
+    std::mutex orphansMtx;                         // Retire-списки завершившихся потоков
+    std::vector<Retired> orphans;
+
+    HazardDomain() = default;
+
+    ThreadRecord& localRecord();
+    ThreadRecord* acquireRecord();
+    void releaseRecord(ThreadRecord* record);
+
+    size_t scanThreshold() const;
+    void scan(std::vector<Retired>& list);
+};
+
+// Политика освобождения для контейнеров, параметризованных схемой reclamation
+// (см. LockFreeList). Каждый прочитанный узел нужно защитить и перепроверить
+struct HazardReclaimer
+{
+    static constexpr bool NEEDS_VALIDATION = true;
+
+    class Guard
+    {
+    private:
+        HazardDomain::Guard guard;
+    public:
+        Guard() : guard(HazardDomain::instance().pin()) {}
+        void protect(int slot, void* ptr) { guard.protect(slot, ptr); }
+    };
+
+    template<typename T>
+    static void retire(T* ptr) { HazardDomain::instance().retire(ptr); }
+    static HazardDomain& domain() { return HazardDomain::instance(); }
+};
+
+#endif
@@ -0,0 +1,122 @@
+#ifndef HISTORYRECORDER_H
+#define HISTORYRECORDER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+enum class OpType : uint8_t
+{
+    Insert,
+    InsertAfter,
+    Remove,
+    Find
+};
+
+// Одна завершенная операция над контейнером: время вызова и ответа
+// в наносекундах steady_clock и возвращенный результат
+struct HistoryOp
+{
+    OpType type;
+    int value;          // Вставляемое / удаляемое / искомое значение
+    int target;         // Для InsertAfter - значение, после которого вставляем
+    bool result;        // Для void-операций всегда true
+    int thread;
+    uint64_t invoke;
+    uint64_t response;
+};
+
+// Запись истории операций для проверки линеаризуемости.
+//
+// У каждого потока свой заранее выделенный буфер, в который пишет только
+// он сам, поэтому запись не берет блокировок и не делит кэш-линии с другими
+// потоками. Размер буфера публикуется release-записью; читать историю
+// (collect) можно после завершения потоков. Переполненный буфер отбрасывает
+// операции и считает их - такую историю проверять нельзя.
+class HistoryRecorder
+{
+private:
+    struct alignas(64) Buffer
+    {
+        std::vector<HistoryOp> ops;
+        std::atomic<size_t> size{0};
+        std::atomic<size_t> dropped{0};
+    };
+
+    std::vector<Buffer> buffers;
+
+    static uint64_t now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+public:
+    HistoryRecorder(int threads, size_t capacityPerThread) : buffers(threads)
+    {
+        for (Buffer& buffer : buffers)
+        {
+            buffer.ops.resize(capacityPerThread);
+        }
+    }
+
+    // Выполняет op и записывает его вызов и ответ в буфер потока thread
+    template<typename Op>
+    auto record(int thread, OpType type, int value, int target, Op&& op)
+    {
+        Buffer& buffer = buffers[thread];
+        size_t slot = buffer.size.load(std::memory_order_relaxed);
+        bool full = slot >= buffer.ops.size();
+        uint64_t invoke = now();
+
+        if constexpr (std::is_void_v<std::invoke_result_t<Op>>)
+        {
+            op();
+            if (full)
+            {
+                buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            buffer.ops[slot] = {type, value, target, true, thread, invoke, now()};
+            buffer.size.store(slot + 1, std::memory_order_release);
+        }
+        else
+        {
+            auto result = op();
+            if (full)
+            {
+                buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+                return result;
+            }
+            buffer.ops[slot] = {type, value, target, static_cast<bool>(result), thread, invoke, now()};
+            buffer.size.store(slot + 1, std::memory_order_release);
+            return result;
+        }
+    }
+
+    size_t dropped() const
+    {
+        size_t total = 0;
+        for (const Buffer& buffer : buffers)
+        {
+            total += buffer.dropped.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    // Все записанные операции; вызывать после завершения пишущих потоков
+    std::vector<HistoryOp> collect() const
+    {
+        std::vector<HistoryOp> all;
+        for (const Buffer& buffer : buffers)
+        {
+            size_t size = buffer.size.load(std::memory_order_acquire);
+            all.insert(all.end(), buffer.ops.begin(), buffer.ops.begin() + size);
+        }
+        return all;
+    }
+};
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+// Гистограмма задержек с логарифмическими корзинами в стиле HdrHistogram.
+//
+// Значения меньше 2^SUB_BITS хранятся точно, дальше каждая степень двойки
+// делится на 2^SUB_BITS равных корзин, так что относительная ошибка не
+// превышает 1/32 на всем диапазоне uint64_t. Запись - пара битовых операций
+// и инкремент без блокировок: гистограмма принадлежит одному потоку,
+// а объединяются они (merge) после его завершения.
+class LatencyHistogram
+{
+public:
+    static constexpr int SUB_BITS = 5;
+    static constexpr int SUB_COUNT = 1 << SUB_BITS;
+    static constexpr int BUCKETS = SUB_COUNT + (64 - SUB_BITS) * SUB_COUNT;
+
+private:
+    uint64_t counts[BUCKETS] = {};
+    uint64_t total = 0;
+    uint64_t maxValue = 0;
+
+    static int indexOf(uint64_t value)
+    {
+        if (value < SUB_COUNT)
+        {
+            return static_cast<int>(value);
+        }
+        int exponent = std::bit_width(value) - 1;
+        int shift = exponent - SUB_BITS;
+        int sub = static_cast<int>(value >> shift) - SUB_COUNT;
+        return SUB_COUNT + shift * SUB_COUNT + sub;
+    }
+
+    // Наибольшее значение, попадающее в корзину index
+    static uint64_t highestIn(int index)
+    {
+        if (index < SUB_COUNT)
+        {
+            return static_cast<uint64_t>(index);
+        }
+        int shift = (index - SUB_COUNT) / SUB_COUNT;
+        uint64_t sub = static_cast<uint64_t>((index - SUB_COUNT) % SUB_COUNT);
+        uint64_t lowest = (SUB_COUNT + sub) << shift;
+        return lowest + ((uint64_t(1) << shift) - 1);
+    }
+
+public:
+    void record(uint64_t value)
+    {
+        counts[indexOf(value)]++;
+        total++;
+        maxValue = std::max(maxValue, value);
+    }
+
+    void merge(const LatencyHistogram& other)
+    {
+        for (int i = 0; i < BUCKETS; i++)
+        {
+            counts[i] += other.counts[i];
+        }
+        total += other.total;
+        maxValue = std::max(maxValue, other.maxValue);
+    }
+
+    // Значение, не меньше которого percent процентов записей (с точностью корзины)
+    uint64_t percentile(double percent) const
+    {
+        if (total == 0)
+        {
+            return 0;
+        }
+        uint64_t rank = static_cast<uint64_t>(std::ceil(percent / 100.0 * total));
+        rank = std::clamp<uint64_t>(rank, 1, total);
+        uint64_t seen = 0;
+        for (int i = 0; i < BUCKETS; i++)
+        {
+            seen += counts[i];
+            if (seen >= rank)
+            {
+                return std::min(highestIn(i), maxValue);
+            }
+        }
+        return maxValue;
+    }
+
+    uint64_t count() const { return total; }
+    uint64_t max() const { return maxValue; }
+};
+
+#endif
@@ -0,0 +1,156 @@
+#include "LazyList.h"
+#include "EpochDomain.h"
+#include <iostream>
+#include <vector>
+
+LazyList::LazyList() : head(0) {}
+
+LazyList::~LazyList()
+{
+    Node* current = head.next.load(std::memory_order_relaxed);
+    while (current != nullptr)
+    {
+        Node* next = current->next.load(std::memory_order_relaxed);
+        delete current;
+        current = next;
+    }
+}
+
+void LazyList::locate(int value, Node*& pred, Node*& curr)
+{
+    pred = &head;
+    curr = head.next.load(std::memory_order_acquire);
+    while (curr != nullptr && curr->value < value)
+    {
+        pred = curr;
+        curr = curr->next.load(std::memory_order_acquire);
+    }
+}
+
+bool LazyList::validate(Node* pred, Node* curr)
+{
+    // Оба узла в списке и по-прежнему соседние
+    return !pred->marked.load(std::memory_order_acquire) &&
+           (curr == nullptr || !curr->marked.load(std::memory_order_acquire)) &&
+           pred->next.load(std::memory_order_acquire) == curr;
+}
+
+bool LazyList::insert(int value)
+{
+    auto guard = EpochDomain::instance().pin();
+    while (true)
+    {
+        Node* pred;
+        Node* curr;
+        locate(value, pred, curr);
+
+        std::lock_guard<std::mutex> predLock(pred->mtx);
+        std::unique_lock<std::mutex> currLock;
+        if (curr != nullptr)
+        {
+            currLock = std::unique_lock<std::mutex>(curr->mtx);
+        }
+
+        if (!validate(pred, curr))
+        {
+            continue;
+        }
+        if (curr != nullptr && curr->value == value)
+        {
+            return false;
+        }
+
+        Node* newNode = new Node(value);
+        newNode->next.store(curr, std::memory_order_relaxed);
+        pred->next.store(newNode, std::memory_order_release);
+        count.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+}
+
+bool LazyList::insertAfter(int targetValue, int newValue)
+{
+    // В упорядоченном множестве место вставки определяется значением
+    (void)targetValue;
+    return insert(newValue);
+}
+
+bool LazyList::remove(int value)
+{
+    auto guard = EpochDomain::instance().pin();
+    while (true)
+    {
+        Node* pred;
+        Node* curr;
+        locate(value, pred, curr);
+
+        if (curr == nullptr || curr->value != value)
+        {
+            // Отрицательный ответ не требует блокировок, как и в find
+            return false;
+        }
+
+        std::lock_guard<std::mutex> predLock(pred->mtx);
+        std::lock_guard<std::mutex> currLock(curr->mtx);
+
+        if (!validate(pred, curr))
+        {
+            continue;
+        }
+
+        curr->marked.store(true, std::memory_order_release);
+        pred->next.store(curr->next.load(std::memory_order_relaxed), std::memory_order_release);
+        count.fetch_sub(1, std::memory_order_relaxed);
+        EpochDomain::instance().retire(curr);
+        return true;
+    }
+}
+
+bool LazyList::find(int value)
+{
+    auto guard = EpochDomain::instance().pin();
+    Node* curr = head.next.load(std::memory_order_acquire);
+    while (curr != nullptr && curr->value < value)
+    {
+        curr = curr->next.load(std::memory_order_acquire);
+    }
+    return curr != nullptr && curr->value == value && !curr->marked.load(std::memory_order_acquire);
+}
+
+void LazyList::print() const
+{
+    std::vector<int> values;
+    {
+        auto guard = EpochDomain::instance().pin();
+        Node* current = head.next.load(std::memory_order_acquire);
+        while (current != nullptr)
+        {
+            if (!current->marked.load(std::memory_order_acquire))
+            {
+                values.push_back(current->value);
+            }
+            current = current->next.load(std::memory_order_acquire);
+        }
+    }
+
+    std::cout << "List: ";
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        std::cout << values[i];
+        if (i + 1 < values.size())
+        {
+            std::cout << " -> ";
+        }
+    }
+    std::cout << " -> NULL" << std::endl;
+}
+
+int LazyList::size() const
+{
+    return count.load(std::memory_order_relaxed);
+}
+
+bool LazyList::empty() const
+{
+    return head.next.load(std::memory_order_acquire) == nullptr;
+}
@@ -0,0 +1,49 @@
+#ifndef LAZYLIST_H
+#define LAZYLIST_H
+
+#include <atomic>
+#include <mutex>
+
+// Ленивый список (lazy list): упорядоченное множество с блокировкой на
+// каждом узле и флагом marked.
+//
+// insert/remove идут по списку без блокировок, захватывают только пару
+// pred/curr и после захвата проверяют, что оба узла не удалены и все еще
+// соседние; иначе повторяют попытку. Удаление сначала ставит marked
+// (логическое удаление), затем вырезает узел. find не берет блокировок и
+// ничего не пишет в узлы, поэтому читатели никогда не ждут писателей.
+// Вырезанные узлы освобождаются через EpochDomain.
+class LazyList
+{
+private:
+    struct Node
+    {
+        int value;
+        std::atomic<Node*> next;
+        std::atomic<bool> marked;
+        std::mutex mtx;
+        Node(int val) : value(val), next(nullptr), marked(false) {}
+    };
+
+    Node head;                  // Фиктивный узел перед первым элементом
+    std::atomic<int> count{0};
+
+    // pred->value < value <= curr->value (curr может быть nullptr)
+    void locate(int value, Node*& pred, Node*& curr);
+    static bool validate(Node* pred, Node* curr);
+
+public:
+    LazyList();
+    ~LazyList();
+
+    bool insert(int value);                    // Вставка, false если значение уже есть
+    bool insertAfter(int targetValue, int newValue); // Позицию задает порядок, target не влияет
+    bool remove(int value);                    // Удаление по значению
+    bool find(int value);                      // Поиск без блокировок
+
+    void print() const;                        // Вывод списка
+    int size() const;                          // Размер списка
+    bool empty() const;                        // Проверка на пустоту
+};
+
+#endif
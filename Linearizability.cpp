@@ -0,0 +1,265 @@
+#include "Linearizability.h"
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <sstream>
+#include <unordered_set>
+
+namespace
+{
+
+// Событие вызова или ответа в двусвязном списке, упорядоченном по времени
+struct Entry
+{
+    bool isCall;
+    size_t op;                  // Индекс операции в подистории
+    uint64_t time;
+    Entry* match = nullptr;     // Для вызова - его ответ
+    Entry* prev = nullptr;
+    Entry* next = nullptr;
+};
+
+// Уже посещенная конфигурация: множество линеаризованных операций и состояние
+struct Config
+{
+    std::vector<uint64_t> linearized;
+    int state;
+
+    bool operator==(const Config& other) const
+    {
+        return state == other.state && linearized == other.linearized;
+    }
+};
+
+struct ConfigHash
+{
+    size_t operator()(const Config& config) const
+    {
+        uint64_t h = static_cast<uint64_t>(config.state) * 0x9E3779B97F4A7C15ull;
+        for (uint64_t word : config.linearized)
+        {
+            h ^= word + 0x9E3779B97F4A7C15ull + (h << 6) + (h >> 2);
+        }
+        return static_cast<size_t>(h);
+    }
+};
+
+// Последовательная спецификация для одного ключа; state - число его копий.
+// Возвращает false, если результат операции невозможен в состоянии state
+bool step(ListModel model, const HistoryOp& op, int state, int& next)
+{
+    switch (op.type)
+    {
+    case OpType::Insert:
+    case OpType::InsertAfter:
+        if (model == ListModel::Multiset)
+        {
+            next = state + 1;
+            return true;
+        }
+        next = op.result ? 1 : state;
+        return op.result == (state == 0);
+    case OpType::Remove:
+        next = op.result ? state - 1 : state;
+        return op.result == (state > 0);
+    case OpType::Find:
+        next = state;
+        return op.result == (state > 0);
+    }
+    return false;
+}
+
+const char* opName(OpType type)
+{
+    switch (type)
+    {
+    case OpType::Insert: return "insert";
+    case OpType::InsertAfter: return "insertAfter";
+    case OpType::Remove: return "remove";
+    case OpType::Find: return "find";
+    }
+    return "?";
+}
+
+void lift(Entry* call)
+{
+    call->prev->next = call->next;
+    call->next->prev = call->prev;
+    Entry* ret = call->match;
+    ret->prev->next = ret->next;
+    if (ret->next != nullptr)
+    {
+        ret->next->prev = ret->prev;
+    }
+}
+
+void unlift(Entry* call)
+{
+    Entry* ret = call->match;
+    ret->prev->next = ret;
+    if (ret->next != nullptr)
+    {
+        ret->next->prev = ret;
+    }
+    call->prev->next = call;
+    call->next->prev = call;
+}
+
+// Проверка подистории одного ключа: поиск с возвратом по порядкам
+// линеаризации, совместимым с реальным временем
+bool checkPartition(const std::vector<HistoryOp>& ops, ListModel model, int initialState,
+                    size_t& statesExplored)
+{
+    std::vector<Entry> entries;
+    entries.reserve(ops.size() * 2);
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        entries.push_back({true, i, ops[i].invoke});
+        entries.push_back({false, i, ops[i].response});
+    }
+    // При равном времени вызов раньше ответа: операции считаются пересекающимися
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b)
+    {
+        if (a.time != b.time)
+        {
+            return a.time < b.time;
+        }
+        return a.isCall && !b.isCall;
+    });
+
+    std::vector<Entry*> callOf(ops.size());
+    for (Entry& entry : entries)
+    {
+        if (entry.isCall)
+        {
+            callOf[entry.op] = &entry;
+        }
+    }
+    for (Entry& entry : entries)
+    {
+        if (!entry.isCall)
+        {
+            callOf[entry.op]->match = &entry;
+        }
+    }
+
+    Entry head{false, 0, 0};
+    Entry* last = &head;
+    for (Entry& entry : entries)
+    {
+        last->next = &entry;
+        entry.prev = last;
+        last = &entry;
+    }
+
+    struct Frame
+    {
+        Entry* call;
+        int state;
+    };
+    std::vector<Frame> stack;
+    std::unordered_set<Config, ConfigHash> cache;
+    std::vector<uint64_t> linearized((ops.size() + 63) / 64, 0);
+    int state = initialState;
+
+    Entry* entry = head.next;
+    while (head.next != nullptr)
+    {
+        if (entry->isCall)
+        {
+            int next = 0;
+            if (step(model, ops[entry->op], state, next))
+            {
+                std::vector<uint64_t> candidate = linearized;
+                candidate[entry->op / 64] |= uint64_t(1) << (entry->op % 64);
+                if (cache.insert({std::move(candidate), next}).second)
+                {
+                    statesExplored++;
+                    stack.push_back({entry, state});
+                    linearized[entry->op / 64] |= uint64_t(1) << (entry->op % 64);
+                    state = next;
+                    lift(entry);
+                    entry = head.next;
+                    continue;
+                }
+            }
+            entry = entry->next;
+        }
+        else
+        {
+            // Дошли до ответа нелинеаризованной операции - откатываемся
+            if (stack.empty())
+            {
+                return false;
+            }
+            Frame frame = stack.back();
+            stack.pop_back();
+            state = frame.state;
+            linearized[frame.call->op / 64] &= ~(uint64_t(1) << (frame.call->op % 64));
+            unlift(frame.call);
+            entry = frame.call->next;
+        }
+    }
+    return true;
+}
+
+}
+
+LinearizabilityResult checkLinearizability(const std::vector<HistoryOp>& history,
+                                           ListModel model,
+                                           const std::vector<int>& initial)
+{
+    LinearizabilityResult result;
+    result.operations = history.size();
+
+    std::map<int, std::vector<HistoryOp>> partitions;
+    for (const HistoryOp& op : history)
+    {
+        partitions[op.value].push_back(op);
+    }
+    result.partitions = partitions.size();
+    for (auto& [key, ops] : partitions)
+    {
+        std::sort(ops.begin(), ops.end(), [](const HistoryOp& a, const HistoryOp& b)
+        {
+            return a.invoke < b.invoke;
+        });
+    }
+
+    std::map<int, int> initialState;
+    for (int value : initial)
+    {
+        int& copies = initialState[value];
+        copies = model == ListModel::Set ? 1 : copies + 1;
+    }
+
+    for (const auto& [key, ops] : partitions)
+    {
+        auto it = initialState.find(key);
+        int start = it == initialState.end() ? 0 : it->second;
+        if (!checkPartition(ops, model, start, result.statesExplored))
+        {
+            result.linearizable = false;
+            result.failedKey = key;
+
+            std::ostringstream out;
+            out << "key " << key << " (initial copies " << start << ", "
+                << ops.size() << " ops):";
+            size_t shown = std::min<size_t>(ops.size(), 12);
+            for (size_t i = 0; i < shown; i++)
+            {
+                const HistoryOp& op = ops[i];
+                out << "\n  T" << op.thread << " " << opName(op.type) << "(" << op.value
+                    << ") -> " << (op.result ? "true" : "false")
+                    << " [" << op.invoke << ", " << op.response << "]";
+            }
+            if (shown < ops.size())
+            {
+                out << "\n  ...";
+            }
+            result.details = out.str();
+            return result;
+        }
+    }
+    return result;
+}
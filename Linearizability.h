@@ -0,0 +1,37 @@
+#ifndef LINEARIZABILITY_H
+#define LINEARIZABILITY_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "HistoryRecorder.h"
+
+// Модель последовательной спецификации контейнера
+enum class ListModel
+{
+    Multiset,   // LinkedList и его варианты: повторы разрешены, insert всегда вставляет
+    Set         // Множества: insert возвращает false, если значение уже есть
+};
+
+struct LinearizabilityResult
+{
+    bool linearizable = true;
+    size_t operations = 0;      // Проверено операций
+    size_t partitions = 0;      // Независимых ключей
+    size_t statesExplored = 0;  // Состояний, посещенных поиском
+    int failedKey = 0;          // Ключ, история которого не линеаризуема
+    std::string details;        // Описание ошибки
+};
+
+// Офлайн-проверка линеаризуемости истории (алгоритм Wing-Gong с мемоизацией
+// Lowe). Все операции над контейнером затрагивают ровно одно значение,
+// а спецификация раскладывается по значениям (P-композициональность), поэтому
+// история делится на независимые подистории по ключу, и каждая проверяется
+// отдельно с состоянием "сколько копий ключа в контейнере".
+//
+// initial - содержимое контейнера до начала записи истории.
+LinearizabilityResult checkLinearizability(const std::vector<HistoryOp>& history,
+                                           ListModel model,
+                                           const std::vector<int>& initial);
+
+#endif
@@ -1,11 +1,12 @@
 #include "LinkedList.h"
 #include <iostream>
+#include <algorithm>
 
 LinkedList::LinkedList() : head(nullptr) {}
 
 LinkedList::~LinkedList() 
 {
-    std::lock_guard<std::recursive_mutex> lock(mtx);
+    std::unique_lock lock(mtx);
     Node* current = head;
     while (current != nullptr) 
     {
@@ -15,39 +16,47 @@ LinkedList::~LinkedList()
     }
 }
 
-void LinkedList::insert(int value) 
+void LinkedList::insertLocked(Node* newNode) 
 {
-    std::lock_guard<std::recursive_mutex> lock(mtx); 
-    
-    Node* newNode = new Node(value);
     newNode->next = head;
     head = newNode;
+    count.fetch_add(1, std::memory_order_relaxed);
+    version.fetch_add(1, std::memory_order_release);
+}
+
+void LinkedList::insert(int value) 
+{
+    Node* newNode = new Node(value);
+    std::unique_lock lock(mtx);
+    insertLocked(newNode);
 }
 
 void LinkedList::insertAfter(int targetValue, int newValue) 
 {
-    std::lock_guard<std::recursive_mutex> lock(mtx);
+    Node* newNode = new Node(newValue);
+    std::unique_lock lock(mtx);
     
     Node* current = head;
     while (current != nullptr) 
     {
         if (current->value == targetValue) 
         {
-            Node* newNode = new Node(newValue);
             newNode->next = current->next;
             current->next = newNode;
+            count.fetch_add(1, std::memory_order_relaxed);
+            version.fetch_add(1, std::memory_order_release);
             return;
         }
         current = current->next;
     }
     
-    // Если target не найден, вставляем в начало без рекурсивного вызова insert()
-    insert(newValue);
+    // Если target не найден, вставляем в начало под той же блокировкой
+    insertLocked(newNode);
 }
 
 bool LinkedList::remove(int value) 
 {
-    std::lock_guard<std::recursive_mutex> lock(mtx);
+    std::unique_lock lock(mtx);
     
     if (head == nullptr) return false;
     
@@ -55,6 +64,8 @@ bool LinkedList::remove(int value)
     {
         Node* temp = head;
         head = head->next;
+        count.fetch_sub(1, std::memory_order_relaxed);
+        version.fetch_add(1, std::memory_order_release);
         delete temp;
         return true;
     }
@@ -66,6 +77,8 @@ bool LinkedList::remove(int value)
         {
             Node* temp = current->next;
             current->next = current->next->next;
+            count.fetch_sub(1, std::memory_order_relaxed);
+            version.fetch_add(1, std::memory_order_release);
             delete temp;
             return true;
         }
@@ -77,7 +90,7 @@ bool LinkedList::remove(int value)
 
 bool LinkedList::find(int value) 
 {
-    std::lock_guard<std::recursive_mutex> lock(mtx);
+    std::shared_lock lock(mtx);
     
     Node* current = head;
     while (current != nullptr) 
@@ -91,40 +104,200 @@ bool LinkedList::find(int value)
     return false;
 }
 
+void LinkedList::insertBulk(std::span<const int> values) 
+{
+    if (values.empty()) return;
+    
+    // Цепочку собираем до захвата блокировки: последний элемент пачки
+    // должен оказаться первым, как после серии insert()
+    Node* first = nullptr;
+    Node* last = nullptr;
+    for (int value : values) 
+    {
+        Node* newNode = new Node(value);
+        newNode->next = first;
+        first = newNode;
+        if (last == nullptr) 
+        {
+            last = newNode;
+        }
+    }
+    
+    std::unique_lock lock(mtx);
+    last->next = head;
+    head = first;
+    count.fetch_add(static_cast<int>(values.size()), std::memory_order_relaxed);
+    version.fetch_add(1, std::memory_order_release);
+}
+
+int LinkedList::removeBulk(std::span<const int> values) 
+{
+    // Сколько вхождений каждого значения осталось удалить
+    std::vector<int> keys(values.begin(), values.end());
+    std::sort(keys.begin(), keys.end());
+    std::vector<int> pending;
+    std::vector<int> unique;
+    for (int key : keys) 
+    {
+        if (unique.empty() || unique.back() != key) 
+        {
+            unique.push_back(key);
+            pending.push_back(0);
+        }
+        pending.back()++;
+    }
+    
+    std::vector<Node*> removed;
+    {
+        std::unique_lock lock(mtx);
+        
+        size_t left = keys.size();
+        Node** link = &head;
+        while (*link != nullptr && left > 0) 
+        {
+            Node* current = *link;
+            auto it = std::lower_bound(unique.begin(), unique.end(), current->value);
+            if (it != unique.end() && *it == current->value && pending[it - unique.begin()] > 0) 
+            {
+                pending[it - unique.begin()]--;
+                left--;
+                count.fetch_sub(1, std::memory_order_relaxed);
+                *link = current->next;
+                removed.push_back(current);
+            }
+            else 
+            {
+                link = &current->next;
+            }
+        }
+        if (!removed.empty()) 
+        {
+            version.fetch_add(1, std::memory_order_release);
+        }
+    }
+    
+    // Узлы уже недостижимы, освобождаем их после снятия блокировки
+    for (Node* node : removed) 
+    {
+        delete node;
+    }
+    return static_cast<int>(removed.size());
+}
+
+void LinkedList::findBulk(std::span<const int> values, std::vector<bool>& found) 
+{
+    std::vector<int> unique(values.begin(), values.end());
+    std::sort(unique.begin(), unique.end());
+    unique.erase(std::unique(unique.begin(), unique.end()), unique.end());
+    std::vector<bool> present(unique.size(), false);
+    
+    {
+        std::shared_lock lock(mtx);
+        
+        size_t left = unique.size();
+        Node* current = head;
+        while (current != nullptr && left > 0) 
+        {
+            auto it = std::lower_bound(unique.begin(), unique.end(), current->value);
+            if (it != unique.end() && *it == current->value && !present[it - unique.begin()]) 
+            {
+                present[it - unique.begin()] = true;
+                left--;
+            }
+            current = current->next;
+        }
+    }
+    
+    found.assign(values.size(), false);
+    for (size_t i = 0; i < values.size(); i++) 
+    {
+        auto it = std::lower_bound(unique.begin(), unique.end(), values[i]);
+        found[i] = present[it - unique.begin()];
+    }
+}
+
+LinkedList::Snapshot LinkedList::snapshot() const 
+{
+    std::shared_ptr<const CachedSnapshot> current = cached.load(std::memory_order_acquire);
+    if (current != nullptr && current->version == version.load(std::memory_order_acquire)) 
+    {
+        return Snapshot(std::shared_ptr<const std::vector<int>>(current, &current->values), current->version);
+    }
+    
+    // Копируем под shared-блокировкой: писатели ждут только копирования,
+    // а дальнейший обход снимка идет уже без блокировок. Одновременные
+    // snapshot() копируют параллельно
+    auto fresh = std::make_shared<CachedSnapshot>();
+    {
+        std::shared_lock lock(mtx);
+        fresh->version = version.load(std::memory_order_relaxed);
+        fresh->values.reserve(count.load(std::memory_order_relaxed));
+        for (Node* node = head; node != nullptr; node = node->next) 
+        {
+            fresh->values.push_back(node->value);
+        }
+    }
+    
+    // Публикуем, только если наш снимок новее закэшированного
+    {
+        std::lock_guard<std::mutex> cacheLock(snapshotMtx);
+        std::shared_ptr<const CachedSnapshot> published = cached.load(std::memory_order_relaxed);
+        if (published == nullptr || published->version < fresh->version) 
+        {
+            cached.store(fresh, std::memory_order_release);
+        }
+    }
+    return Snapshot(std::shared_ptr<const std::vector<int>>(fresh, &fresh->values), fresh->version);
+}
+
+std::vector<int> LinkedList::Snapshot::range(int lo, int hi) const 
+{
+    std::vector<int> result;
+    for (int value : *values) 
+    {
+        if (value >= lo && value <= hi) 
+        {
+            result.push_back(value);
+        }
+    }
+    return result;
+}
+
+std::vector<int> LinkedList::range(int lo, int hi) const 
+{
+    return snapshot().range(lo, hi);
+}
+
 void LinkedList::print() const 
 {
-    std::lock_guard<std::recursive_mutex> lock(mtx);
+    Snapshot snap = snapshot();
     
     std::cout << "List: ";
-    Node* current = head;
-    while (current != nullptr) 
+    bool first = true;
+    for (int value : snap) 
     {
-        std::cout << current->value;
-        if (current->next != nullptr) 
+        if (!first) 
         {
             std::cout << " -> ";
         }
-        current = current->next;
+        std::cout << value;
+        first = false;
     }
     std::cout << " -> NULL" << std::endl;
 }
 
 int LinkedList::size() const 
 {
-    std::lock_guard<std::recursive_mutex> lock(mtx);
-    
-    int count = 0;
-    Node* current = head;
-    while (current != nullptr) 
-    {
-        count++;
-        current = current->next;
-    }
-    return count;
+    return count.load(std::memory_order_relaxed);
 }
 
 bool LinkedList::empty() const 
 {
-    std::lock_guard<std::recursive_mutex> lock(mtx);
+    std::shared_lock lock(mtx);
     return head == nullptr;
+}
+
+NodePoolStats LinkedList::allocationStats() 
+{
+    return NodePool<Node>::stats();
 }
\ No newline at end of file
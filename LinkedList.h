@@ -2,19 +2,67 @@
 #define LINKEDLIST_H
 
 #include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <memory>
+#include <span>
+#include <vector>
+#include "NodePool.h"
+#include "LockProfiler.h"
 
 class LinkedList 
 {
+public:
+    // Согласованный снимок списка. Держит копию значений, поэтому обход
+    // снимка не блокирует писателей и не видит их последующих изменений
+    class Snapshot 
+    {
+    private:
+        std::shared_ptr<const std::vector<int>> values;
+        uint64_t listVersion;
+    public:
+        Snapshot(std::shared_ptr<const std::vector<int>> v, uint64_t ver) 
+            : values(std::move(v)), listVersion(ver) {}
+        
+        std::vector<int>::const_iterator begin() const { return values->begin(); }
+        std::vector<int>::const_iterator end() const { return values->end(); }
+        size_t size() const { return values->size(); }
+        bool empty() const { return values->empty(); }
+        uint64_t version() const { return listVersion; }
+        
+        std::vector<int> range(int lo, int hi) const;   // Значения из [lo, hi] в порядке списка
+    };
+
 private:
     struct Node 
     {
         int value;
         Node* next;
         Node(int val) : value(val), next(nullptr) {}
+
+        // Узлы берутся из пула потока, а не из глобального аллокатора
+        static void* operator new(size_t) { return NodePool<Node>::allocate(); }
+        static void operator delete(void* ptr) { NodePool<Node>::deallocate(ptr); }
     };
     
     Node* head;
-    mutable std::recursive_mutex mtx;
+    std::atomic<int> count{0};                 // Размер поддерживается при вставке/удалении
+    mutable ProfiledSharedMutex mtx{"LinkedList::mtx"};   // Читатели берут shared, писатели - unique
+    std::atomic<uint64_t> version{0};          // Растет при каждом изменении, меняется под mtx
+
+    struct CachedSnapshot
+    {
+        std::vector<int> values;
+        uint64_t version;
+    };
+
+    // Последний снимок: пока список не менялся, snapshot() отдает его без
+    // копирования. Читается атомарно без блокировок; snapshotMtx нужен
+    // только для публикации нового снимка
+    mutable std::atomic<std::shared_ptr<const CachedSnapshot>> cached;
+    mutable std::mutex snapshotMtx;
+
+    void insertLocked(Node* newNode);          // Вставка в начало, mtx уже захвачен
 
 public:
     LinkedList();
@@ -25,9 +73,20 @@ public:
     bool remove(int value);                    // Удаление по значению
     bool find(int value);                      // Поиск элемента
 
-    void print() const;                        // Вывод списка
+    // Пакетные операции: один захват блокировки и не больше одного обхода
+    // на всю пачку. Результат тот же, что у поэлементных вызовов по порядку
+    void insertBulk(std::span<const int> values);   // Вставка пачки в начало
+    int removeBulk(std::span<const int> values);    // Возвращает число удаленных
+    void findBulk(std::span<const int> values, std::vector<bool>& found); // found[i] - есть ли values[i]
+
+    Snapshot snapshot() const;                 // Копия значений на текущий момент
+    std::vector<int> range(int lo, int hi) const; // Значения из [lo, hi] в порядке списка
+
+    void print() const;                        // Вывод списка (по снимку, без блокировки на время вывода)
     int size() const;                          // Размер списка
     bool empty() const;                        // Проверка на пустоту
+
+    static NodePoolStats allocationStats();    // Статистика пула узлов
 };
 
 #endif
\ No newline at end of file
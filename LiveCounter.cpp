@@ -1,43 +1,258 @@
 #include "LiveCounter.h"
+#include <algorithm>
 #include <iostream>
-#include <mutex>
+#include <map>
+#include <chrono>
+#include <iterator>
+#include <stdexcept>
 
-void LiveCounter::update(const std::string& key, const std::string& message) 
+LiveCounter::~LiveCounter()
 {
-    std::lock_guard lock(mtx);
-    
-    if (last_values[key] == message) 
-    {
-        counters[key]++;
-    }
-    else 
-    {
-        counters[key] = 1;
-        last_values[key] = message;
-    }
-    
-    refresh_line(key, message + " (Repeat: " + std::to_string(counters[key]) + ")");
+    shutdown();
 }
 
-void LiveCounter::refresh_line(const std::string& key, const std::string& full_message) 
+LiveCounter::Handle LiveCounter::register_key(const std::string& key)
 {
-    static std::map<std::string, int> line_positions = 
+    static const std::map<std::string, int> line_positions =
     {
         {"writer", 1},
-        {"square", 2}, 
+        {"square", 2},
         {"double", 3},
         {"plus2", 4},
         {"final", 5}
     };
-    
-    int line = line_positions[key];
+
+    auto it = line_positions.find(key);
+    if (it == line_positions.end() || it->second > MAX_KEYS)
+    {
+        throw std::invalid_argument("unknown LiveCounter key: " + key);
+    }
+    return Handle{it->second - 1};
+}
+
+LiveCounter::Format LiveCounter::register_format(const std::string& pattern)
+{
+    std::lock_guard lock(formats_mtx);
+    for (int i = 0; i < format_count; i++)
+    {
+        if (formats[i] == pattern)
+        {
+            return Format{i};
+        }
+    }
+    if (format_count == MAX_FORMATS)
+    {
+        throw std::length_error("too many LiveCounter formats");
+    }
+    formats[format_count] = pattern;
+    return Format{format_count++};
+}
+
+namespace
+{
+
+// Номер писателя потока: потоки по очереди получают слоты 0, 1, 2, ...
+int producer_index()
+{
+    static std::atomic<int> next_producer{0};
+    thread_local int index = next_producer.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+uint64_t now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}
+
+void LiveCounter::publish(int line, const Record& record)
+{
+    // Обычно слот потока свободен и CAS проходит с первого раза. Занятым он
+    // бывает, только если потоков больше MAX_WRITERS: тогда пробуем соседние
+    int first = producer_index();
+    for (int n = 0; n < MAX_WRITERS; n++)
+    {
+        Slot& slot = slots[line][(first + n) % MAX_WRITERS];
+        uint64_t seq = slot.seq.load(std::memory_order_relaxed);
+        if ((seq & 1) == 0 && slot.seq.compare_exchange_strong(seq, seq + 1, std::memory_order_acquire,
+                                                               std::memory_order_relaxed))
+        {
+            write_slot(slot, seq, record);
+            return;
+        }
+    }
+    // Все слоты строки заняты прямо сейчас - запись пропускается
+}
+
+void LiveCounter::write_slot(Slot& slot, uint64_t seq, const Record& record)
+{
+    // Нечетный seq должен стать видимым раньше новых данных
+    std::atomic_thread_fence(std::memory_order_release);
+
+    bool same = seq != 0;
+    for (int i = 0; same && i < RECORD_WORDS; i++)
+    {
+        same = slot.record[i].load(std::memory_order_relaxed) == record.words[i];
+    }
+
+    if (same)
+    {
+        slot.repeat.store(slot.repeat.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+    else
+    {
+        for (int i = 0; i < RECORD_WORDS; i++)
+        {
+            slot.record[i].store(record.words[i], std::memory_order_relaxed);
+        }
+        slot.repeat.store(1, std::memory_order_relaxed);
+    }
+    slot.stamp.store(now_ns(), std::memory_order_relaxed);
+
+    slot.seq.store(seq + 2, std::memory_order_release);
+}
+
+bool LiveCounter::read_slot(const Slot& slot, uint64_t& stamp, Record& record, uint64_t& repeat) const
+{
+    while (true)
+    {
+        uint64_t before = slot.seq.load(std::memory_order_acquire);
+        if ((before & 1) != 0)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        if (before == 0)
+        {
+            return false;       // В слот еще ничего не писали
+        }
+
+        repeat = slot.repeat.load(std::memory_order_relaxed);
+        stamp = slot.stamp.load(std::memory_order_relaxed);
+        for (int i = 0; i < RECORD_WORDS; i++)
+        {
+            record.words[i] = slot.record[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (slot.seq.load(std::memory_order_relaxed) == before)
+        {
+            return true;
+        }
+    }
+}
+
+std::string LiveCounter::format_record(const Record& record)
+{
+    int id = static_cast<int>(record.words[0] & 0xFFFFFFFF);
+    int argc = static_cast<int>(record.words[0] >> 32);
+
+    std::lock_guard lock(formats_mtx);
+    const std::string& pattern = formats[id];
+    std::string message;
+    int arg = 0;
+    for (size_t i = 0; i < pattern.size(); i++)
+    {
+        if (pattern[i] == '{' && i + 1 < pattern.size() && pattern[i + 1] == '}' && arg < argc)
+        {
+            message += std::to_string(static_cast<int64_t>(record.words[1 + arg++]));
+            i++;
+        }
+        else
+        {
+            message += pattern[i];
+        }
+    }
+    return message;
+}
+
+void LiveCounter::start_renderer()
+{
+    if (!rendering.exchange(true))
+    {
+        renderer = std::thread(&LiveCounter::render_loop, this);
+    }
+}
+
+void LiveCounter::render_loop()
+{
+    uint64_t drawn[MAX_KEYS] = {};
+    auto frame = std::chrono::microseconds(1000000 / FPS);
+    auto next = std::chrono::steady_clock::now();
+
+    while (rendering.load(std::memory_order_acquire))
+    {
+        render_frame(drawn);
+        next += frame;
+        std::this_thread::sleep_until(next);
+    }
+    render_frame(drawn);        // Последнее состояние после остановки писателей
+}
+
+void LiveCounter::render_frame(uint64_t drawn[])
+{
+    bool changed = false;
+    for (int line = 0; line < MAX_KEYS; line++)
+    {
+        // Сводим слоты писателей строки: показываем самую свежую запись,
+        // повторы одинаковых записей разных писателей складываются
+        Record records[MAX_WRITERS];
+        uint64_t repeats[MAX_WRITERS] = {};
+        bool written[MAX_WRITERS] = {};
+        uint64_t latest = 0;
+        int newest = -1;
+        for (int w = 0; w < MAX_WRITERS; w++)
+        {
+            uint64_t stamp = 0;
+            written[w] = read_slot(slots[line][w], stamp, records[w], repeats[w]);
+            if (written[w] && (newest < 0 || stamp > latest))
+            {
+                latest = stamp;
+                newest = w;
+            }
+        }
+        if (newest < 0 || latest == drawn[line])
+        {
+            continue;
+        }
+
+        uint64_t repeat = 0;
+        for (int w = 0; w < MAX_WRITERS; w++)
+        {
+            if (written[w] && std::equal(std::begin(records[w].words), std::end(records[w].words),
+                                         std::begin(records[newest].words)))
+            {
+                repeat += repeats[w];
+            }
+        }
+        drawn[line] = latest;
+        refresh_line(line + 1, format_record(records[newest]) + " (Repeat: " + std::to_string(repeat) + ")");
+        changed = true;
+    }
+    if (changed)
+    {
+        std::cout.flush();
+    }
+}
+
+void LiveCounter::refresh_line(int line, const std::string& full_message)
+{
     std::cout << "\033[" << line << ";1H";
     std::cout << "\033[K";
     std::cout << full_message;
-    std::cout.flush();
 }
 
-void LiveCounter::init_display() 
+void LiveCounter::shutdown()
+{
+    if (rendering.exchange(false))
+    {
+        renderer.join();
+    }
+}
+
+void LiveCounter::init_display()
 {
     std::cout << "\033[2J";
     std::cout << "\033[1;1H";
@@ -45,13 +260,14 @@ void LiveCounter::init_display()
         std::cout << std::endl;
     std::cout << "=== RW-Lock Live Counters ===\n";
     std::cout << ">>> Writer: initializing...\n";
-    std::cout << "[Square] initializing...\n"; 
+    std::cout << "[Square] initializing...\n";
     std::cout << "[Double] initializing...\n";
     std::cout << "[Plus2] initializing...\n";
     std::cout.flush();
+    start_renderer();
 }
 
-void LiveCounter::init_display_pipeline() 
+void LiveCounter::init_display_pipeline()
 {
     std::cout << "\033[2J";
     std::cout << "\033[1;1H";
@@ -59,9 +275,10 @@ void LiveCounter::init_display_pipeline()
         std::cout << std::endl;
     std::cout << "=== Pipeline Processing (Condition Variables) ===\n";
     std::cout << ">>> Writer: initializing...\n";
-    std::cout << "[Stage1-Square] initializing...\n"; 
+    std::cout << "[Stage1-Square] initializing...\n";
     std::cout << "[Stage2-Double] initializing...\n";
     std::cout << "[Stage3-Plus2] initializing...\n";
     std::cout << "[FINAL] initializing...\n";
     std::cout.flush();
-}
\ No newline at end of file
+    start_renderer();
+}
@@ -2,21 +2,117 @@
 #define LIVECOUNTER_H
 
 #include <string>
-#include <map>
+#include <atomic>
+#include <cstdint>
 #include <mutex>
+#include <thread>
+#include <type_traits>
 
-class LiveCounter 
+// Живое табло: строка на ключ с последним сообщением и числом повторов.
+//
+// Ключ регистрируется один раз (register_key) и дальше передается как
+// целочисленный дескриптор - номер строки табло. Сообщение
+// тоже не строка, а запись фиксированного размера: номер заранее
+// зарегистрированного формата ("[Square] {}^2 = {}") и до MAX_ARGS целых
+// аргументов. Строку из нее собирает только рендерер, поэтому update не
+// выделяет память, а повтор определяется сравнением записей.
+//
+// update не берет блокировок, не ждет других писателей и не трогает
+// терминал. У каждой строки табло MAX_WRITERS слотов, поток-производитель
+// пишет в свой слот (номер выдается потоку при первом update), поэтому
+// писатели одного ключа не делят ни слот, ни кэш-линию. Слот защищен
+// счетчиком последовательности (seqlock): нечетное значение - идет запись.
+// Если потоков больше MAX_WRITERS и слот потока сейчас занят, update
+// пробует следующие слоты строки, а если заняты все - пропускает запись,
+// но не ждет. Экран перерисовывает отдельный поток с частотой FPS: для
+// каждой строки он сводит слоты писателей, показывая самую свежую запись
+// и суммарное число ее повторов, и выводит только изменившиеся строки.
+class LiveCounter
 {
+public:
+    static constexpr int MAX_KEYS = 8;
+    static constexpr int MAX_FORMATS = 32;
+    static constexpr int MAX_ARGS = 4;
+    static constexpr int MAX_WRITERS = 16;
+    static constexpr int FPS = 30;
+
+    struct Handle
+    {
+        int slot = -1;
+    };
+
+    struct Format
+    {
+        int id = -1;
+    };
+
 private:
-    std::map<std::string, int> counters;
-    std::map<std::string, std::string> last_values;
-    std::mutex mtx;
-    
+    static constexpr int RECORD_WORDS = 1 + MAX_ARGS;
+
+    // Слово 0 - номер формата и число аргументов, далее аргументы
+    struct Record
+    {
+        uint64_t words[RECORD_WORDS] = {};
+    };
+
+    // Слот одного писателя: ровно одна кэш-линия
+    struct alignas(64) Slot
+    {
+        std::atomic<uint64_t> seq{0};
+        std::atomic<uint64_t> repeat{0};
+        std::atomic<uint64_t> stamp{0};     // Время последней записи, нс
+        std::atomic<uint64_t> record[RECORD_WORDS] = {};
+    };
+
+    Slot slots[MAX_KEYS][MAX_WRITERS];
+    std::string formats[MAX_FORMATS];
+    int format_count = 0;
+    std::mutex formats_mtx;                 // Только регистрация и рендерер
+
+    std::thread renderer;
+    std::atomic<bool> rendering{false};
+
+    void publish(int line, const Record& record);
+    void write_slot(Slot& slot, uint64_t seq, const Record& record);
+    bool read_slot(const Slot& slot, uint64_t& stamp, Record& record, uint64_t& repeat) const;
+    std::string format_record(const Record& record);
+
+    void start_renderer();
+    void render_loop();
+    void render_frame(uint64_t drawn[]);
+    void refresh_line(int line, const std::string& full_message);
+
 public:
-    void update(const std::string& key, const std::string& message);
-    void refresh_line(const std::string& key, const std::string& full_message);
+    LiveCounter() = default;
+    ~LiveCounter();
+
+    LiveCounter(const LiveCounter&) = delete;
+    LiveCounter& operator=(const LiveCounter&) = delete;
+
+    // Дескриптор ключа: writer, square, double, plus2 или final
+    // (строки табло 1-5); для неизвестного ключа - invalid_argument
+    Handle register_key(const std::string& key);
+
+    // Шаблон сообщения, каждое {} заменяется очередным аргументом update
+    Format register_format(const std::string& pattern);
+
+    template<typename... Args>
+    void update(Handle key, Format format, Args... args)
+    {
+        static_assert(sizeof...(Args) <= MAX_ARGS, "too many LiveCounter arguments");
+        static_assert((std::is_integral_v<Args> && ...), "LiveCounter arguments must be integers");
+
+        Record record;
+        record.words[0] = static_cast<uint64_t>(format.id) | (uint64_t(sizeof...(Args)) << 32);
+        int i = 1;
+        ((record.words[i++] = static_cast<uint64_t>(static_cast<int64_t>(args))), ...);
+        (void)i;
+        publish(key.slot, record);
+    }
+
     void init_display();
-    void init_display_pipeline(); 
+    void init_display_pipeline();
+    void shutdown();            // Останавливает рендерер, рисуя последний кадр
 };
 
-#endif
\ No newline at end of file
+#endif
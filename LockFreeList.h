@@ -0,0 +1,298 @@
+#ifndef LOCKFREELIST_H
+#define LOCKFREELIST_H
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "EpochDomain.h"
+
+// Lock-free упорядоченное множество (Harris-Michael).
+// Удаление двухфазное: сначала узел логически помечается младшим битом
+// указателя next, затем физически вырезается CAS-ом на предыдущей ссылке.
+// Операции совпадают с LinkedList, но значения хранятся без повторов
+// и по возрастанию.
+//
+// Reclaimer задает схему освобождения вырезанных узлов: EpochReclaimer
+// (EpochDomain.h) или HazardReclaimer (HazardDomain.h). Обход написан
+// по схеме Michael: каждый узел публикуется в слоте 0, узел-владелец prev
+// держится в слоте 1, и после публикации ссылка перепроверяется.
+template<typename Reclaimer = EpochReclaimer>
+class LockFreeList
+{
+private:
+    struct Node
+    {
+        int value;
+        std::atomic<Node*> next;
+        Node(int val) : value(val), next(nullptr) {}
+    };
+
+    using Guard = typename Reclaimer::Guard;
+
+    std::atomic<Node*> head;
+    std::atomic<int> count;
+
+    static bool isMarked(Node* ptr)
+    {
+        return (reinterpret_cast<std::uintptr_t>(ptr) & 1) != 0;
+    }
+    static Node* marked(Node* ptr)
+    {
+        return reinterpret_cast<Node*>(reinterpret_cast<std::uintptr_t>(ptr) | 1);
+    }
+    static Node* unmarked(Node* ptr)
+    {
+        return reinterpret_cast<Node*>(reinterpret_cast<std::uintptr_t>(ptr) & ~std::uintptr_t(1));
+    }
+
+    // Публикует curr и проверяет, что prev все еще указывает на него
+    // без пометки, т.е. curr не был вырезан до публикации
+    static bool protect(Guard& guard, std::atomic<Node*>* prev, Node* curr)
+    {
+        guard.protect(0, curr);
+        if constexpr (Reclaimer::NEEDS_VALIDATION)
+        {
+            return prev->load(std::memory_order_acquire) == curr;
+        }
+        return true;
+    }
+
+    // Ищет первый узел со значением >= value, по пути вырезая помеченные.
+    // prev - ссылка, указывающая на curr
+    bool search(int value, std::atomic<Node*>*& prev, Node*& curr, Guard& guard)
+    {
+    retry:
+        prev = &head;
+        curr = prev->load(std::memory_order_acquire);
+        while (true)
+        {
+            if (curr == nullptr)
+            {
+                return false;
+            }
+            if (!protect(guard, prev, curr))
+            {
+                goto retry;
+            }
+
+            Node* next = curr->next.load(std::memory_order_acquire);
+            if (isMarked(next))
+            {
+                // curr удален логически - помогаем вырезать его из списка.
+                // CAS не пройдет, если prev сам помечен или уже указывает не на curr
+                Node* expected = curr;
+                if (!prev->compare_exchange_strong(expected, unmarked(next),
+                                                   std::memory_order_acq_rel, std::memory_order_acquire))
+                {
+                    goto retry;
+                }
+                Reclaimer::retire(curr);
+                curr = unmarked(next);
+                continue;
+            }
+
+            if (curr->value >= value)
+            {
+                return curr->value == value;
+            }
+
+            prev = &curr->next;
+            guard.protect(1, curr);
+            curr = next;
+        }
+    }
+
+    // Значения непомеченных узлов по порядку
+    std::vector<int> collect() const
+    {
+        Guard guard;
+        std::vector<int> values;
+        while (true)
+        {
+            values.clear();
+            bool restart = false;
+            const std::atomic<Node*>* prev = &head;
+            Node* curr = unmarked(prev->load(std::memory_order_acquire));
+            while (curr != nullptr)
+            {
+                guard.protect(0, curr);
+                if constexpr (Reclaimer::NEEDS_VALIDATION)
+                {
+                    if (prev->load(std::memory_order_acquire) != curr)
+                    {
+                        restart = true;
+                        break;
+                    }
+                }
+
+                Node* next = curr->next.load(std::memory_order_acquire);
+                if (!isMarked(next))
+                {
+                    values.push_back(curr->value);
+                }
+                else if constexpr (Reclaimer::NEEDS_VALIDATION)
+                {
+                    // За следом помеченного узла идти нельзя: его next заморожен,
+                    // и следующий узел может быть освобожден без нашего ведома
+                    restart = true;
+                    break;
+                }
+
+                prev = &curr->next;
+                guard.protect(1, curr);
+                curr = unmarked(next);
+            }
+            if (!restart)
+            {
+                return values;
+            }
+        }
+    }
+
+public:
+    LockFreeList() : head(nullptr), count(0) {}
+
+    ~LockFreeList()
+    {
+        Node* current = unmarked(head.load(std::memory_order_relaxed));
+        while (current != nullptr)
+        {
+            Node* next = unmarked(current->next.load(std::memory_order_relaxed));
+            delete current;
+            current = next;
+        }
+    }
+
+    LockFreeList(const LockFreeList&) = delete;
+    LockFreeList& operator=(const LockFreeList&) = delete;
+
+    // Вставка, false если значение уже есть
+    bool insert(int value)
+    {
+        Guard guard;
+        Node* newNode = nullptr;
+        while (true)
+        {
+            std::atomic<Node*>* prev;
+            Node* curr;
+            if (search(value, prev, curr, guard))
+            {
+                delete newNode;
+                return false;
+            }
+
+            if (newNode == nullptr)
+            {
+                newNode = new Node(value);
+            }
+            newNode->next.store(curr, std::memory_order_relaxed);
+
+            Node* expected = curr;
+            if (prev->compare_exchange_strong(expected, newNode,
+                                              std::memory_order_release, std::memory_order_relaxed))
+            {
+                count.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+
+    // В упорядоченном множестве место вставки определяется значением
+    bool insertAfter(int targetValue, int newValue)
+    {
+        (void)targetValue;
+        return insert(newValue);
+    }
+
+    bool remove(int value)
+    {
+        Guard guard;
+        while (true)
+        {
+            std::atomic<Node*>* prev;
+            Node* curr;
+            if (!search(value, prev, curr, guard))
+            {
+                return false;
+            }
+
+            // Логическое удаление: помечаем next. Кто пометил - тот и удалил
+            Node* next = curr->next.load(std::memory_order_acquire);
+            if (isMarked(next))
+            {
+                continue;
+            }
+            if (!curr->next.compare_exchange_strong(next, marked(next),
+                                                    std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                continue;
+            }
+            count.fetch_sub(1, std::memory_order_relaxed);
+
+            // Физическое удаление; если не вышло, узел вырежет следующий search
+            Node* expected = curr;
+            if (prev->compare_exchange_strong(expected, next,
+                                              std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                Reclaimer::retire(curr);
+            }
+            else
+            {
+                search(value, prev, curr, guard);
+            }
+            return true;
+        }
+    }
+
+    bool find(int value)
+    {
+        Guard guard;
+        if constexpr (Reclaimer::NEEDS_VALIDATION)
+        {
+            // С hazard pointers идти через помеченные узлы нельзя,
+            // поэтому поиск вырезает их так же, как search
+            std::atomic<Node*>* prev;
+            Node* curr;
+            return search(value, prev, curr, guard);
+        }
+        else
+        {
+            // Под эпохой поиск ничего не пишет в узлы списка
+            Node* curr = unmarked(head.load(std::memory_order_acquire));
+            while (curr != nullptr && curr->value < value)
+            {
+                curr = unmarked(curr->next.load(std::memory_order_acquire));
+            }
+            return curr != nullptr && curr->value == value &&
+                   !isMarked(curr->next.load(std::memory_order_acquire));
+        }
+    }
+
+    void print() const
+    {
+        std::vector<int> values = collect();
+        std::cout << "List: ";
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            std::cout << values[i];
+            if (i + 1 < values.size())
+            {
+                std::cout << " -> ";
+            }
+        }
+        std::cout << " -> NULL" << std::endl;
+    }
+
+    int size() const
+    {
+        return count.load(std::memory_order_relaxed);
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+};
+
+#endif
@@ -0,0 +1,79 @@
+#include "LockProfiler.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+LockProfiler& LockProfiler::instance()
+{
+    static LockProfiler profiler;
+    return profiler;
+}
+
+LockProfiler::~LockProfiler()
+{
+    report(TOP_N);
+}
+
+LockStats* LockProfiler::statsFor(const std::string& name)
+{
+    std::lock_guard lock(mtx);
+    for (LockStats& entry : stats)
+    {
+        if (entry.name == name)
+        {
+            return &entry;
+        }
+    }
+    return &stats.emplace_back(name);
+}
+
+void LockProfiler::report(size_t topN)
+{
+    std::lock_guard lock(mtx);
+
+    std::vector<LockStats*> used;
+    for (LockStats& entry : stats)
+    {
+        if (entry.total(&LockStats::Shard::acquisitions) > 0)
+        {
+            used.push_back(&entry);
+        }
+    }
+    if (used.empty())
+    {
+        return;
+    }
+    std::sort(used.begin(), used.end(), [](const LockStats* a, const LockStats* b)
+    {
+        return a->total(&LockStats::Shard::waitNs) > b->total(&LockStats::Shard::waitNs);
+    });
+    if (used.size() > topN)
+    {
+        used.resize(topN);
+    }
+
+    std::cout << "\n=== Lock contention (top " << used.size() << " by wait time) ===\n";
+    std::cout << std::left << std::setw(24) << "Lock" << std::right
+              << std::setw(12) << "acquired" << std::setw(10) << "shared"
+              << std::setw(11) << "contended" << std::setw(8) << "%"
+              << std::setw(12) << "wait ms" << std::setw(12) << "max wait us"
+              << std::setw(12) << "hold ms" << std::setw(12) << "avg hold ns" << "\n";
+    for (const LockStats* entry : used)
+    {
+        uint64_t acquisitions = entry->total(&LockStats::Shard::acquisitions);
+        uint64_t contended = entry->total(&LockStats::Shard::contended);
+        uint64_t holdNs = entry->total(&LockStats::Shard::holdNs);
+        std::cout << std::left << std::setw(24) << entry->name << std::right
+                  << std::setw(12) << acquisitions
+                  << std::setw(10) << entry->total(&LockStats::Shard::sharedAcquisitions)
+                  << std::setw(11) << contended
+                  << std::setw(8) << std::fixed << std::setprecision(1) << 100.0 * contended / acquisitions
+                  << std::setw(12) << std::setprecision(2) << entry->total(&LockStats::Shard::waitNs) / 1e6
+                  << std::setw(12) << std::setprecision(1) << entry->maxWait() / 1e3
+                  << std::setw(12) << std::setprecision(2) << holdNs / 1e6
+                  << std::setw(12) << holdNs / acquisitions << "\n";
+    }
+    std::cout.unsetf(std::ios::fixed);
+    std::cout.flush();
+}
@@ -0,0 +1,291 @@
+#ifndef LOCKPROFILER_H
+#define LOCKPROFILER_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+
+// Статистика одной именованной блокировки. Экземпляры с одинаковым именем
+// (например, мьютексы всех объектов LinkedList) пишут в общую запись.
+// Счетчики разложены по SHARDS шардам на отдельных кэш-линиях, шард
+// выбирается по потоку, поэтому захваты в разных потоках не пишут в одну
+// линию; суммы собираются только при печати отчета
+struct LockStats
+{
+    static constexpr int SHARDS = 64;
+
+    struct alignas(64) Shard
+    {
+        std::atomic<uint64_t> acquisitions{0};     // Все захваты, включая shared
+        std::atomic<uint64_t> sharedAcquisitions{0};
+        std::atomic<uint64_t> contended{0};        // Захваты, которым пришлось ждать
+        std::atomic<uint64_t> waitNs{0};
+        std::atomic<uint64_t> maxWaitNs{0};
+        std::atomic<uint64_t> holdNs{0};
+    };
+
+    std::string name;
+    Shard shards[SHARDS];
+
+    explicit LockStats(std::string lockName) : name(std::move(lockName)) {}
+
+    static Shard& localShard(LockStats* stats)
+    {
+        static std::atomic<int> nextShard{0};
+        thread_local int index = nextShard.fetch_add(1, std::memory_order_relaxed) % SHARDS;
+        return stats->shards[index];
+    }
+
+    void addWait(uint64_t ns)
+    {
+        Shard& shard = localShard(this);
+        shard.contended.fetch_add(1, std::memory_order_relaxed);
+        shard.waitNs.fetch_add(ns, std::memory_order_relaxed);
+        uint64_t seen = shard.maxWaitNs.load(std::memory_order_relaxed);
+        while (ns > seen && !shard.maxWaitNs.compare_exchange_weak(seen, ns, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    // Сумма (или максимум) поля по всем шардам
+    uint64_t total(std::atomic<uint64_t> Shard::* field) const
+    {
+        uint64_t sum = 0;
+        for (const Shard& shard : shards)
+        {
+            sum += (shard.*field).load(std::memory_order_relaxed);
+        }
+        return sum;
+    }
+
+    uint64_t maxWait() const
+    {
+        uint64_t result = 0;
+        for (const Shard& shard : shards)
+        {
+            result = std::max(result, shard.maxWaitNs.load(std::memory_order_relaxed));
+        }
+        return result;
+    }
+};
+
+// Реестр статистики блокировок. При завершении программы печатает
+// TOP_N блокировок с наибольшим суммарным временем ожидания
+class LockProfiler
+{
+private:
+    std::mutex mtx;
+    std::deque<LockStats> stats;               // deque не перемещает элементы
+
+    LockProfiler() = default;
+
+public:
+    static constexpr size_t TOP_N = 10;
+
+    ~LockProfiler();
+
+    static LockProfiler& instance();
+
+    LockStats* statsFor(const std::string& name);
+    void report(size_t topN);
+};
+
+namespace lock_profiler_detail
+{
+
+inline uint64_t nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Время начала shared-захватов текущего потока. Держателей shared-блокировки
+// может быть много, поэтому время хранится у потока, а не у мьютекса.
+// Глубже MAX_HELD вложенных захватов время удержания не учитывается
+struct SharedHolds
+{
+    static constexpr int MAX_HELD = 16;
+    const void* owners[MAX_HELD];
+    uint64_t starts[MAX_HELD];
+    int size = 0;
+
+    void push(const void* owner, uint64_t start)
+    {
+        if (size < MAX_HELD)
+        {
+            owners[size] = owner;
+            starts[size] = start;
+            size++;
+        }
+    }
+
+    // Время начала последнего захвата owner или 0, если он не учтен
+    uint64_t pop(const void* owner)
+    {
+        for (int i = size - 1; i >= 0; i--)
+        {
+            if (owners[i] == owner)
+            {
+                uint64_t start = starts[i];
+                for (int j = i + 1; j < size; j++)
+                {
+                    owners[j - 1] = owners[j];
+                    starts[j - 1] = starts[j];
+                }
+                size--;
+                return start;
+            }
+        }
+        return 0;
+    }
+};
+
+inline thread_local SharedHolds sharedHolds;
+
+}
+
+// Обертка над мьютексом, считающая захваты, ожидания и время удержания.
+// Быстрый путь - try_lock без чтения часов на ожидание; часы читаются
+// только при захвате и освобождении для времени удержания.
+// Неудачный try_lock быстрого пути сам по себе не считается конфликтом:
+// try_lock может отказать ложно, поэтому захват засчитывается как
+// конфликтный, только если блокирующий lock потом ждал дольше
+// MIN_WAIT_NS. Неудачные try_lock/try_lock_shared пользователя тоже не
+// считаются.
+// Интерфейс совпадает с оборачиваемым мьютексом, поэтому работают
+// lock_guard, unique_lock, shared_lock и condition_variable_any
+template<typename Mutex>
+class BasicProfiledMutex
+{
+private:
+    static constexpr uint64_t MIN_WAIT_NS = 1000;
+
+    Mutex mtx;
+    LockStats* stats;
+    uint64_t acquiredAt = 0;                   // Меняет только владелец
+    int depth = 0;                             // Глубина для recursive_mutex
+
+    void waited(uint64_t start)
+    {
+        uint64_t ns = lock_profiler_detail::nowNs() - start;
+        if (ns >= MIN_WAIT_NS)
+        {
+            stats->addWait(ns);
+        }
+    }
+
+    void acquired()
+    {
+        if (depth++ == 0)
+        {
+            acquiredAt = lock_profiler_detail::nowNs();
+        }
+        LockStats::localShard(stats).acquisitions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void sharedAcquired()
+    {
+        lock_profiler_detail::sharedHolds.push(this, lock_profiler_detail::nowNs());
+        LockStats::Shard& shard = LockStats::localShard(stats);
+        shard.acquisitions.fetch_add(1, std::memory_order_relaxed);
+        shard.sharedAcquisitions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+public:
+    explicit BasicProfiledMutex(const std::string& name)
+        : stats(LockProfiler::instance().statsFor(name)) {}
+
+    BasicProfiledMutex(const BasicProfiledMutex&) = delete;
+    BasicProfiledMutex& operator=(const BasicProfiledMutex&) = delete;
+
+    void lock()
+    {
+        if (!mtx.try_lock())
+        {
+            uint64_t start = lock_profiler_detail::nowNs();
+            mtx.lock();
+            waited(start);
+        }
+        acquired();
+    }
+
+    bool try_lock()
+    {
+        if (!mtx.try_lock())
+        {
+            return false;
+        }
+        acquired();
+        return true;
+    }
+
+    void unlock()
+    {
+        if (--depth == 0)
+        {
+            LockStats::localShard(stats).holdNs.fetch_add(lock_profiler_detail::nowNs() - acquiredAt,
+                                                          std::memory_order_relaxed);
+        }
+        mtx.unlock();
+    }
+
+    void lock_shared() requires requires(Mutex& m) { m.lock_shared(); }
+    {
+        if (!mtx.try_lock_shared())
+        {
+            uint64_t start = lock_profiler_detail::nowNs();
+            mtx.lock_shared();
+            waited(start);
+        }
+        sharedAcquired();
+    }
+
+    bool try_lock_shared() requires requires(Mutex& m) { m.try_lock_shared(); }
+    {
+        if (!mtx.try_lock_shared())
+        {
+            return false;
+        }
+        sharedAcquired();
+        return true;
+    }
+
+    void unlock_shared() requires requires(Mutex& m) { m.unlock_shared(); }
+    {
+        uint64_t start = lock_profiler_detail::sharedHolds.pop(this);
+        if (start != 0)
+        {
+            LockStats::localShard(stats).holdNs.fetch_add(lock_profiler_detail::nowNs() - start,
+                                                          std::memory_order_relaxed);
+        }
+        mtx.unlock_shared();
+    }
+};
+
+// Мьютекс с именем для профилировщика, когда профилирование выключено:
+// тот же std-мьютекс без каких-либо накладных расходов, имя игнорируется
+template<typename Mutex>
+class NamedMutex : public Mutex
+{
+public:
+    explicit NamedMutex(const char*) {}
+};
+
+// Профилирование включается сборкой с -DLOCK_PROFILE (make LOCK_PROFILE=1).
+// Без него Profiled*-мьютексы - обычные std-мьютексы
+#ifdef LOCK_PROFILE
+using ProfiledMutex = BasicProfiledMutex<std::mutex>;
+using ProfiledSharedMutex = BasicProfiledMutex<std::shared_mutex>;
+using ProfiledRecursiveMutex = BasicProfiledMutex<std::recursive_mutex>;
+#else
+using ProfiledMutex = NamedMutex<std::mutex>;
+using ProfiledSharedMutex = NamedMutex<std::shared_mutex>;
+using ProfiledRecursiveMutex = NamedMutex<std::recursive_mutex>;
+#endif
+
+#endif
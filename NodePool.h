@@ -0,0 +1,233 @@
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+struct NodePoolStats
+{
+    uint64_t allocations = 0;      // Выданных блоков
+    uint64_t deallocations = 0;    // Возвращенных блоков
+    uint64_t slabs = 0;            // Запросов памяти у системного аллокатора
+    uint64_t refills = 0;          // Пачек, взятых потоками из общего пула
+    uint64_t flushes = 0;          // Пачек, возвращенных потоками в общий пул
+};
+
+// Пул узлов фиксированного размера для объектов T.
+//
+// У каждого потока свой список свободных блоков, поэтому выделение и
+// освобождение обычно обходятся без блокировок. Блоки переходят между
+// потоком и общим пулом пачками по BATCH штук: пустой локальный список
+// берет пачку из пула (или нарезает новый слаб), переполненный отдает.
+// Слабы выровнены по кэш-линии, а размер блока округлен так, что узел
+// не пересекает границу линии.
+//
+// Пример подключения:
+//     struct Node {
+//         static void* operator new(size_t) { return NodePool<Node>::allocate(); }
+//         static void operator delete(void* p) { NodePool<Node>::deallocate(p); }
+//     };
+template<typename T, size_t SLAB_BYTES = 64 * 1024, size_t BATCH = 64>
+class NodePool
+{
+private:
+    static constexpr size_t CACHE_LINE = 64;
+
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    static constexpr size_t roundBlock(size_t size)
+    {
+        if (size > CACHE_LINE)
+        {
+            return (size + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+        }
+        size_t block = sizeof(FreeBlock);
+        while (block < size)
+        {
+            block *= 2;
+        }
+        return block;
+    }
+
+    static constexpr size_t BLOCK_SIZE = roundBlock(sizeof(T) > sizeof(FreeBlock) ? sizeof(T) : sizeof(FreeBlock));
+    static constexpr size_t BLOCKS_PER_SLAB = SLAB_BYTES / BLOCK_SIZE;
+
+    static_assert(alignof(T) <= CACHE_LINE, "NodePool: alignment above cache line is not supported");
+    static_assert(BLOCKS_PER_SLAB >= BATCH, "NodePool: slab must hold at least one batch");
+
+    struct Batch
+    {
+        FreeBlock* head;
+        size_t count;
+    };
+
+    struct Shared
+    {
+        std::mutex mtx;
+        std::vector<Batch> batches;
+        std::vector<void*> slabs;
+        std::atomic<uint64_t> allocations{0};
+        std::atomic<uint64_t> deallocations{0};
+        std::atomic<uint64_t> refills{0};
+        std::atomic<uint64_t> flushes{0};
+
+        ~Shared()
+        {
+            for (void* slab : slabs)
+            {
+                ::operator delete(slab, std::align_val_t(CACHE_LINE));
+            }
+        }
+    };
+
+    struct LocalCache
+    {
+        FreeBlock* head = nullptr;
+        size_t count = 0;
+        uint64_t allocations = 0;      // Счетчики копятся локально и
+        uint64_t deallocations = 0;    // сбрасываются вместе с пачками
+
+        ~LocalCache()
+        {
+            publishCounters(*this);
+            if (head != nullptr)
+            {
+                Shared& s = shared();
+                std::lock_guard<std::mutex> lock(s.mtx);
+                s.batches.push_back({head, count});
+            }
+        }
+    };
+
+    static Shared& shared()
+    {
+        static Shared s;
+        return s;
+    }
+
+    static LocalCache& local()
+    {
+        thread_local LocalCache cache;
+        return cache;
+    }
+
+    static void publishCounters(LocalCache& cache)
+    {
+        Shared& s = shared();
+        s.allocations.fetch_add(cache.allocations, std::memory_order_relaxed);
+        s.deallocations.fetch_add(cache.deallocations, std::memory_order_relaxed);
+        cache.allocations = 0;
+        cache.deallocations = 0;
+    }
+
+    static void refill(LocalCache& cache)
+    {
+        Shared& s = shared();
+        publishCounters(cache);
+
+        std::lock_guard<std::mutex> lock(s.mtx);
+        if (!s.batches.empty())
+        {
+            Batch batch = s.batches.back();
+            s.batches.pop_back();
+            cache.head = batch.head;
+            cache.count = batch.count;
+            s.refills.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // Общий пул пуст - нарезаем новый слаб
+        char* slab = static_cast<char*>(::operator new(SLAB_BYTES, std::align_val_t(CACHE_LINE)));
+        s.slabs.push_back(slab);
+        FreeBlock* head = nullptr;
+        for (size_t i = BLOCKS_PER_SLAB; i > 0; i--)
+        {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + (i - 1) * BLOCK_SIZE);
+            block->next = head;
+            head = block;
+        }
+        cache.head = head;
+        cache.count = BLOCKS_PER_SLAB;
+    }
+
+    static void flush(LocalCache& cache)
+    {
+        // Отдаем в общий пул ровно BATCH блоков, остальные остаются у потока
+        FreeBlock* batchHead = cache.head;
+        FreeBlock* batchTail = batchHead;
+        for (size_t i = 1; i < BATCH; i++)
+        {
+            batchTail = batchTail->next;
+        }
+        cache.head = batchTail->next;
+        cache.count -= BATCH;
+        batchTail->next = nullptr;
+
+        Shared& s = shared();
+        publishCounters(cache);
+        std::lock_guard<std::mutex> lock(s.mtx);
+        s.batches.push_back({batchHead, BATCH});
+        s.flushes.fetch_add(1, std::memory_order_relaxed);
+    }
+
+public:
+    static void* allocate()
+    {
+        LocalCache& cache = local();
+        if (cache.head == nullptr)
+        {
+            refill(cache);
+        }
+        FreeBlock* block = cache.head;
+        cache.head = block->next;
+        cache.count--;
+        cache.allocations++;
+        return block;
+    }
+
+    static void deallocate(void* ptr)
+    {
+        if (ptr == nullptr)
+        {
+            return;
+        }
+        LocalCache& cache = local();
+        FreeBlock* block = static_cast<FreeBlock*>(ptr);
+        block->next = cache.head;
+        cache.head = block;
+        cache.count++;
+        cache.deallocations++;
+        // Держим у потока не больше слаба, излишек возвращаем пачкой
+        if (cache.count > BLOCKS_PER_SLAB)
+        {
+            flush(cache);
+        }
+    }
+
+    // Счетчики других потоков видны после их очередного обмена с пулом
+    // или завершения; счетчики текущего потока учитываются сразу
+    static NodePoolStats stats()
+    {
+        Shared& s = shared();
+        LocalCache& cache = local();
+        NodePoolStats result;
+        result.allocations = s.allocations.load(std::memory_order_relaxed) + cache.allocations;
+        result.deallocations = s.deallocations.load(std::memory_order_relaxed) + cache.deallocations;
+        result.refills = s.refills.load(std::memory_order_relaxed);
+        result.flushes = s.flushes.load(std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(s.mtx);
+            result.slabs = s.slabs.size();
+        }
+        return result;
+    }
+};
+
+#endif
@@ -0,0 +1,401 @@
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <shared_mutex>
+#include <mutex>
+#include <semaphore>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include "DistributedSharedMutex.h"
+#include "SeqLock.h"
+#include "RcuCell.h"
+#include "LatencyHistogram.h"
+
+// Бенчмарк всех способов разделять значение между читателями и писателями,
+// которые есть в репозитории: std::shared_mutex (Task1), семафорная
+// блокировка (Task2), DistributedSharedMutex, SeqLock и RcuCell.
+//
+//   RWLockBench [--readers=N] [--writers=N] [--seconds=N] [--read-cs=нс]
+//               [--write-cs=нс] [--write-pause=мкс] [--variant=имя]
+//   RWLockBench scaling [мс на точку] [макс. читателей] [удержание, мкс] [пауза, мкс]
+
+using Clock = std::chrono::steady_clock;
+
+// Сумма вычислений читателей, чтобы компилятор их не выбросил
+std::atomic<long long> checksum{0};
+
+void busy_wait(std::chrono::nanoseconds duration) {
+    if (duration.count() <= 0) {
+        return;
+    }
+    auto until = Clock::now() + duration;
+    while (Clock::now() < until) {
+    }
+}
+
+// Классическая блокировка читатель-писатель на семафорах, как в Task2:
+// первый вошедший читатель забирает семафор ресурса, последний вышедший
+// его возвращает. Поэтому нужен именно семафор - отпускает его не тот
+// поток, что захватил. Приоритет у читателей: писатель ждет, пока
+// читатели не схлынут полностью
+class SemaphoreSharedMutex {
+    std::binary_semaphore resource{1};
+    std::binary_semaphore count_sem{1};
+    int readers = 0;
+
+public:
+    void lock() { resource.acquire(); }
+    void unlock() { resource.release(); }
+
+    void lock_shared() {
+        count_sem.acquire();
+        if (++readers == 1) {
+            resource.acquire();
+        }
+        count_sem.release();
+    }
+
+    void unlock_shared() {
+        count_sem.acquire();
+        if (--readers == 0) {
+            resource.release();
+        }
+        count_sem.release();
+    }
+};
+
+// Общий интерфейс вариантов: read выполняет читающую критическую секцию
+// и возвращает прочитанное значение, write - пишущую и возвращает момент,
+// когда писатель получил доступ
+template<typename SharedMutex>
+class LockedValue {
+    SharedMutex mtx;
+    int value = 0;
+
+public:
+    int read(std::chrono::nanoseconds cs) {
+        std::shared_lock lock(mtx);
+        busy_wait(cs);
+        return value;
+    }
+
+    Clock::time_point write(std::chrono::nanoseconds cs) {
+        std::unique_lock lock(mtx);
+        auto acquired = Clock::now();
+        value++;
+        busy_wait(cs);
+        return acquired;
+    }
+};
+
+// Читатель работает с копией, писатели сериализуются отдельным мьютексом
+// и готовят значение до публикации
+class SeqLockValue {
+    SeqLock<int> value{0};
+    std::mutex writers;
+
+public:
+    int read(std::chrono::nanoseconds cs) {
+        int v = value.load();
+        busy_wait(cs);
+        return v;
+    }
+
+    Clock::time_point write(std::chrono::nanoseconds cs) {
+        std::lock_guard lock(writers);
+        auto acquired = Clock::now();
+        int next = value.load() + 1;
+        busy_wait(cs);
+        value.store(next);
+        return acquired;
+    }
+};
+
+class RcuValue {
+    RcuCell<int> value{0};
+
+public:
+    int read(std::chrono::nanoseconds cs) {
+        auto current = value.read();
+        busy_wait(cs);
+        return *current;
+    }
+
+    Clock::time_point write(std::chrono::nanoseconds cs) {
+        Clock::time_point acquired;
+        value.update([&](int& v) {
+            acquired = Clock::now();
+            v++;
+            busy_wait(cs);
+        });
+        return acquired;
+    }
+};
+
+struct SuiteConfig {
+    int readers = 4;
+    int writers = 1;
+    int seconds = 1;                            // На один вариант
+    std::chrono::nanoseconds read_cs{100};
+    std::chrono::nanoseconds write_cs{1000};
+    std::chrono::microseconds write_pause{100}; // Между записями одного писателя
+    std::string variant;                        // Пусто - все варианты
+};
+
+// Статистика одного потока; объединяется после join
+struct RoleStats {
+    long long ops = 0;
+    LatencyHistogram latency;                   // Запрос -> освобождение, нс
+    uint64_t max_wait = 0;                      // Запрос -> захват, нс (писатели)
+};
+
+const int READ_SAMPLE = 8;  // Задержку чтения меряем у каждой 8-й операции
+
+template<typename Variant>
+void run_suite_variant(const std::string& name, const SuiteConfig& config) {
+    Variant shared;
+    std::atomic<bool> running{true};
+    std::vector<RoleStats> reader_stats(config.readers);
+    std::vector<RoleStats> writer_stats(config.writers);
+
+    auto reader = [&](RoleStats& stats) {
+        long long sink = 0;
+        while (running.load(std::memory_order_relaxed)) {
+            if (stats.ops % READ_SAMPLE == 0) {
+                auto start = Clock::now();
+                sink += shared.read(config.read_cs);
+                stats.latency.record(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+            } else {
+                sink += shared.read(config.read_cs);
+            }
+            stats.ops++;
+        }
+        checksum += sink;
+    };
+
+    auto writer = [&](RoleStats& stats) {
+        while (running.load(std::memory_order_relaxed)) {
+            auto request = Clock::now();
+            auto acquired = shared.write(config.write_cs);
+            auto done = Clock::now();
+            stats.latency.record(std::chrono::duration_cast<std::chrono::nanoseconds>(done - request).count());
+            stats.max_wait = std::max<uint64_t>(stats.max_wait,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(acquired - request).count());
+            stats.ops++;
+            std::this_thread::sleep_for(config.write_pause);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (auto& stats : writer_stats) {
+        threads.emplace_back(writer, std::ref(stats));
+    }
+    for (auto& stats : reader_stats) {
+        threads.emplace_back(reader, std::ref(stats));
+    }
+    std::this_thread::sleep_for(std::chrono::seconds(config.seconds));
+    running.store(false);
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    RoleStats reads, writes;
+    for (const auto& stats : reader_stats) {
+        reads.ops += stats.ops;
+        reads.latency.merge(stats.latency);
+    }
+    for (const auto& stats : writer_stats) {
+        writes.ops += stats.ops;
+        writes.latency.merge(stats.latency);
+        writes.max_wait = std::max(writes.max_wait, stats.max_wait);
+    }
+
+    auto us = [](uint64_t ns) { return ns / 1000.0; };
+    std::cout << std::left << std::setw(14) << name << std::right
+              << std::setw(13) << reads.ops / config.seconds
+              << std::setw(10) << writes.ops / config.seconds
+              << std::fixed << std::setprecision(1)
+              << std::setw(10) << us(reads.latency.percentile(50))
+              << std::setw(10) << us(reads.latency.percentile(99))
+              << std::setw(11) << us(reads.latency.max())
+              << std::setw(10) << us(writes.latency.percentile(50))
+              << std::setw(10) << us(writes.latency.percentile(99))
+              << std::setw(11) << us(writes.latency.max())
+              << std::setw(12) << us(writes.max_wait) << std::endl;
+}
+
+SuiteConfig parse_suite(int argc, char* argv[]) {
+    SuiteConfig config;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        size_t eq = arg.find('=');
+        if (arg.rfind("--", 0) != 0 || eq == std::string::npos) {
+            throw std::invalid_argument("expected --name=value, got " + arg);
+        }
+        std::string key = arg.substr(2, eq - 2);
+        std::string value = arg.substr(eq + 1);
+        if (key == "readers") config.readers = std::stoi(value);
+        else if (key == "writers") config.writers = std::stoi(value);
+        else if (key == "seconds") config.seconds = std::stoi(value);
+        else if (key == "read-cs") config.read_cs = std::chrono::nanoseconds(std::stoll(value));
+        else if (key == "write-cs") config.write_cs = std::chrono::nanoseconds(std::stoll(value));
+        else if (key == "write-pause") config.write_pause = std::chrono::microseconds(std::stoll(value));
+        else if (key == "variant") config.variant = value;
+        else throw std::invalid_argument("unknown option --" + key);
+    }
+    if (config.readers < 0 || config.writers < 0 || config.readers + config.writers == 0 || config.seconds < 1 ||
+        config.read_cs.count() < 0 || config.write_cs.count() < 0 || config.write_pause.count() < 0) {
+        throw std::invalid_argument("option out of range");
+    }
+    return config;
+}
+
+const std::vector<std::string> SUITE_VARIANTS = {"shared_mutex", "semaphore", "distributed", "seqlock", "rcu"};
+
+void run_suite(const SuiteConfig& config) {
+    if (!config.variant.empty() &&
+        std::find(SUITE_VARIANTS.begin(), SUITE_VARIANTS.end(), config.variant) == SUITE_VARIANTS.end()) {
+        throw std::invalid_argument("unknown variant " + config.variant +
+                                    " (expected: shared_mutex, semaphore, distributed, seqlock, rcu)");
+    }
+
+    std::cout << "=== RW lock suite: " << config.readers << " readers (cs " << config.read_cs.count() << " ns), "
+              << config.writers << " writers (cs " << config.write_cs.count() << " ns, pause "
+              << config.write_pause.count() << " us), " << config.seconds << " s per variant ===" << std::endl;
+    std::cout << "Latencies in us; read latency sampled every " << READ_SAMPLE << "th op; "
+              << "max wait = longest writer request -> acquire" << std::endl;
+    std::cout << std::left << std::setw(14) << "Variant" << std::right
+              << std::setw(13) << "reads/s" << std::setw(10) << "writes/s"
+              << std::setw(10) << "r p50" << std::setw(10) << "r p99" << std::setw(11) << "r max"
+              << std::setw(10) << "w p50" << std::setw(10) << "w p99" << std::setw(11) << "w max"
+              << std::setw(12) << "max wait" << std::endl;
+
+    auto run = [&]<typename Variant>(const std::string& name) {
+        if (config.variant.empty() || config.variant == name) {
+            run_suite_variant<Variant>(name, config);
+        }
+    };
+    run.template operator()<LockedValue<std::shared_mutex>>("shared_mutex");
+    run.template operator()<LockedValue<SemaphoreSharedMutex>>("semaphore");
+    run.template operator()<LockedValue<DistributedSharedMutex>>("distributed");
+    run.template operator()<SeqLockValue>("seqlock");
+    run.template operator()<RcuValue>("rcu");
+}
+
+// Масштабирование по числу читателей: std::shared_mutex против
+// DistributedSharedMutex на ролях из Task1. Один писатель увеличивает
+// значение, читатели (square, double, plus2 по кругу) читают его. Фаза
+// записи укорочена с 200 мс до микросекунд, иначе все упирается в
+// писателя, а не в стоимость lock_shared.
+struct ScalingConfig {
+    std::chrono::milliseconds duration{500};    // На одну точку
+    int max_readers = 64;
+    std::chrono::microseconds write_hold{20};   // Писатель держит блокировку
+    std::chrono::microseconds write_pause{2000}; // и отдыхает между записями
+};
+
+struct ScalingResult {
+    long long reads = 0;
+    long long writes = 0;
+};
+
+template<typename Lock>
+ScalingResult run_point(int readers, const ScalingConfig& config) {
+    Lock lock;
+    int shared_value = 0;
+    std::atomic<bool> running{true};
+    std::atomic<long long> total_reads{0};
+    std::atomic<long long> total_writes{0};
+
+    auto reader = [&](int role) {
+        long long reads = 0;
+        long long sink = 0;
+        while (running.load(std::memory_order_relaxed)) {
+            int value;
+            {
+                std::shared_lock guard(lock);
+                value = shared_value;
+            }
+            switch (role) {
+                case 0: sink += (long long)value * value; break;
+                case 1: sink += value * 2; break;
+                default: sink += value + 2; break;
+            }
+            reads++;
+        }
+        total_reads += reads;
+        checksum += sink;
+    };
+
+    auto writer = [&]() {
+        long long writes = 0;
+        while (running.load(std::memory_order_relaxed)) {
+            {
+                std::unique_lock guard(lock);
+                shared_value++;
+                busy_wait(config.write_hold);
+            }
+            writes++;
+            std::this_thread::sleep_for(config.write_pause);
+        }
+        total_writes += writes;
+    };
+
+    std::vector<std::thread> threads;
+    threads.emplace_back(writer);
+    for (int i = 0; i < readers; i++) {
+        threads.emplace_back(reader, i % 3);
+    }
+    std::this_thread::sleep_for(config.duration);
+    running.store(false);
+    for (auto& t : threads) {
+        t.join();
+    }
+    return ScalingResult{total_reads.load(), total_writes.load()};
+}
+
+void run_scaling(int argc, char* argv[]) {
+    ScalingConfig config;
+    if (argc > 2) config.duration = std::chrono::milliseconds(std::stoi(argv[2]));
+    if (argc > 3) config.max_readers = std::stoi(argv[3]);
+    if (argc > 4) config.write_hold = std::chrono::microseconds(std::stoi(argv[4]));
+    if (argc > 5) config.write_pause = std::chrono::microseconds(std::stoi(argv[5]));
+
+    double seconds = config.duration.count() / 1000.0;
+    std::cout << "=== shared_mutex vs distributed RW lock: 1 writer (hold " << config.write_hold.count()
+              << " us, pause " << config.write_pause.count() << " us), " << seconds << " s per point, "
+              << std::thread::hardware_concurrency() << " hardware threads ===" << std::endl;
+    std::cout << std::right << std::setw(8) << "Readers"
+              << std::setw(18) << "shared_mutex r/s" << std::setw(10) << "writes"
+              << std::setw(18) << "distributed r/s" << std::setw(10) << "writes"
+              << std::setw(10) << "speedup" << std::endl;
+
+    for (int readers = 1; readers <= config.max_readers; readers *= 2) {
+        ScalingResult baseline = run_point<std::shared_mutex>(readers, config);
+        ScalingResult distributed = run_point<DistributedSharedMutex>(readers, config);
+
+        double speedup = baseline.reads > 0 ? (double)distributed.reads / baseline.reads : 0.0;
+        std::cout << std::setw(8) << readers
+                  << std::setw(18) << (long long)(baseline.reads / seconds) << std::setw(10) << baseline.writes
+                  << std::setw(18) << (long long)(distributed.reads / seconds) << std::setw(10) << distributed.writes
+                  << std::setw(9) << std::fixed << std::setprecision(2) << speedup << "x" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    try {
+        if (argc > 1 && std::string(argv[1]) == "scaling") {
+            run_scaling(argc, argv);
+        } else {
+            run_suite(parse_suite(argc, argv));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
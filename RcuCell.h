@@ -0,0 +1,108 @@
+#ifndef RCUCELL_H
+#define RCUCELL_H
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include "EpochDomain.h"
+
+// Ячейка в стиле RCU для редко изменяемых разделяемых объектов любого
+// размера (конфигурации и т.п.), которые не помещаются в seqlock.
+//
+// Текущая версия лежит за атомарным указателем. Читатель закрепляется в
+// EpochDomain и просто загружает указатель - без атомарных RMW и без
+// записи в общие кэш-линии, поэтому чтение масштабируется с числом
+// читателей. Объект версии неизменяем: писатель копирует его, меняет
+// копию и публикует новый указатель, а старую версию отдает в retire -
+// она освободится после grace period, когда ни один читатель не сможет
+// ее держать. Писатели сериализуются мьютексом.
+//
+// Пример:
+//     RcuCell<Config> config;
+//     {
+//         auto current = config.read();
+//         use(current->field);
+//     }
+//     config.update([](Config& c) { c.field++; });
+template<typename T>
+class RcuCell
+{
+public:
+    // Закрепленная ссылка на версию; действительна, пока жив объект
+    class ReadGuard
+    {
+    private:
+        EpochDomain::Guard guard;
+        const T* ptr;
+
+    public:
+        ReadGuard(EpochDomain::Guard&& g, const T* p) : guard(std::move(g)), ptr(p) {}
+
+        const T& operator*() const { return *ptr; }
+        const T* operator->() const { return ptr; }
+        const T* get() const { return ptr; }
+    };
+
+private:
+    std::atomic<T*> current;
+    std::mutex writeMtx;
+
+    void publish(T* next)
+    {
+        T* old = current.load(std::memory_order_relaxed);
+        current.store(next, std::memory_order_release);
+        EpochDomain::instance().retire(old);
+    }
+
+public:
+    explicit RcuCell(T initial = T{}) : current(new T(std::move(initial))) {}
+
+    ~RcuCell()
+    {
+        delete current.load(std::memory_order_relaxed);
+    }
+
+    RcuCell(const RcuCell&) = delete;
+    RcuCell& operator=(const RcuCell&) = delete;
+
+    ReadGuard read() const
+    {
+        EpochDomain::Guard guard = EpochDomain::instance().pin();
+        return ReadGuard(std::move(guard), current.load(std::memory_order_acquire));
+    }
+
+    // Копия текущей версии без удержания закрепления
+    T snapshot() const
+    {
+        return *read();
+    }
+
+    // Заменяет версию целиком
+    void store(T value)
+    {
+        T* next = new T(std::move(value));
+        std::lock_guard<std::mutex> lock(writeMtx);
+        publish(next);
+    }
+
+    // Копирует текущую версию, применяет mutate к копии и публикует ее.
+    // Одновременные update не теряют изменений друг друга
+    template<typename F>
+    void update(F&& mutate)
+    {
+        std::lock_guard<std::mutex> lock(writeMtx);
+        T* next = new T(*current.load(std::memory_order_relaxed));
+        try
+        {
+            mutate(*next);
+        }
+        catch (...)
+        {
+            delete next;
+            throw;
+        }
+        publish(next);
+    }
+};
+
+#endif
@@ -0,0 +1,95 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+// Последовательная блокировка (seqlock) для небольших тривиально
+// копируемых значений с одним писателем.
+//
+// Писатель не ждет никогда: делает счетчик нечетным, пишет данные и делает
+// его снова четным. Читатель копирует данные между двумя чтениями счетчика
+// и повторяет попытку, если счетчик был нечетным или изменился. Читатели
+// только читают, поэтому кэш-линия не гоняется между ними, и чтение
+// масштабируется с числом читателей. Данные хранятся атомарными словами
+// с relaxed-доступом, чтобы одновременные чтение и запись не были гонкой.
+//
+// Писателей несколько - store нужно защищать внешней блокировкой.
+template<typename T>
+class SeqLock
+{
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLock requires a trivially copyable type");
+
+private:
+    static constexpr size_t WORDS = (sizeof(T) + 7) / 8;
+
+    alignas(64) std::atomic<uint64_t> seq{0};
+    std::atomic<uint64_t> words[WORDS];
+
+public:
+    explicit SeqLock(const T& initial = T{})
+    {
+        uint64_t buffer[WORDS] = {};
+        std::memcpy(buffer, &initial, sizeof(T));
+        for (size_t i = 0; i < WORDS; i++)
+        {
+            words[i].store(buffer[i], std::memory_order_relaxed);
+        }
+    }
+
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+
+    void store(const T& value)
+    {
+        uint64_t buffer[WORDS] = {};
+        std::memcpy(buffer, &value, sizeof(T));
+
+        uint64_t s = seq.load(std::memory_order_relaxed);
+        seq.store(s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < WORDS; i++)
+        {
+            words[i].store(buffer[i], std::memory_order_relaxed);
+        }
+        seq.store(s + 2, std::memory_order_release);
+    }
+
+    T load() const
+    {
+        uint64_t buffer[WORDS];
+        while (true)
+        {
+            uint64_t before = seq.load(std::memory_order_acquire);
+            if ((before & 1) != 0)
+            {
+                std::this_thread::yield();     // Запись идет - писатель мог быть вытеснен
+                continue;
+            }
+            for (size_t i = 0; i < WORDS; i++)
+            {
+                buffer[i] = words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (seq.load(std::memory_order_relaxed) == before)
+            {
+                break;
+            }
+        }
+
+        T value;
+        std::memcpy(&value, buffer, sizeof(T));
+        return value;
+    }
+
+    // Число завершенных записей
+    uint64_t version() const
+    {
+        return seq.load(std::memory_order_acquire) / 2;
+    }
+};
+
+#endif
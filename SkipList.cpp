@@ -0,0 +1,298 @@
+#include "SkipList.h"
+#include <iostream>
+#include <cstdint>
+#include <random>
+
+ConcurrentSkipList::ConcurrentSkipList() : head(INT_MIN, MAX_LEVEL) {}
+
+ConcurrentSkipList::~ConcurrentSkipList()
+{
+    Node* current = head.next[0].load(std::memory_order_relaxed);
+    while (current != nullptr)
+    {
+        Node* next = current->next[0].load(std::memory_order_relaxed);
+        delete current;
+        current = next;
+    }
+}
+
+int ConcurrentSkipList::randomLevel()
+{
+    // Геометрическое распределение с p = 1/2: число уровней равно
+    // числу единичных младших битов случайного слова плюс один
+    thread_local std::mt19937 gen(std::random_device{}());
+    uint32_t bits = gen();
+    int levels = 1;
+    while ((bits & 1) != 0 && levels < MAX_LEVEL)
+    {
+        levels++;
+        bits >>= 1;
+    }
+    return levels;
+}
+
+int ConcurrentSkipList::locate(int value, Node* preds[], Node* succs[]) const
+{
+    int found = -1;
+    Node* pred = const_cast<Node*>(&head);
+    for (int level = MAX_LEVEL - 1; level >= 0; level--)
+    {
+        Node* curr = pred->next[level].load(std::memory_order_acquire);
+        while (curr != nullptr && curr->value < value)
+        {
+            pred = curr;
+            curr = pred->next[level].load(std::memory_order_acquire);
+        }
+        if (found == -1 && curr != nullptr && curr->value == value)
+        {
+            found = level;
+        }
+        preds[level] = pred;
+        succs[level] = curr;
+    }
+    return found;
+}
+
+ConcurrentSkipList::Node* ConcurrentSkipList::lowerBound(int value) const
+{
+    Node* pred = const_cast<Node*>(&head);
+    Node* curr = nullptr;
+    for (int level = MAX_LEVEL - 1; level >= 0; level--)
+    {
+        curr = pred->next[level].load(std::memory_order_acquire);
+        while (curr != nullptr && curr->value < value)
+        {
+            pred = curr;
+            curr = pred->next[level].load(std::memory_order_acquire);
+        }
+    }
+    return curr;
+}
+
+void ConcurrentSkipList::unlockAll(std::vector<Node*>& locked)
+{
+    for (Node* node : locked)
+    {
+        node->mtx.unlock();
+    }
+    locked.clear();
+}
+
+bool ConcurrentSkipList::insert(int value)
+{
+    auto guard = EpochDomain::instance().pin();
+    int topLevel = randomLevel() - 1;
+    Node* preds[MAX_LEVEL];
+    Node* succs[MAX_LEVEL];
+    std::vector<Node*> locked;
+    locked.reserve(topLevel + 1);
+
+    while (true)
+    {
+        int found = locate(value, preds, succs);
+        if (found != -1)
+        {
+            Node* existing = succs[found];
+            if (!existing->marked.load(std::memory_order_acquire))
+            {
+                // Значение уже есть; дожидаемся, пока вставка закончит связывание,
+                // чтобы не вернуть false раньше, чем элемент станет видимым
+                while (!existing->fullyLinked.load(std::memory_order_acquire))
+                {
+                }
+                return false;
+            }
+            continue;   // Найденный узел удаляется - пробуем еще раз
+        }
+
+        // Захватываем предшественников снизу вверх; один узел может быть
+        // предшественником на нескольких уровнях подряд
+        bool valid = true;
+        Node* prevPred = nullptr;
+        for (int level = 0; valid && level <= topLevel; level++)
+        {
+            Node* pred = preds[level];
+            Node* succ = succs[level];
+            if (pred != prevPred)
+            {
+                pred->mtx.lock();
+                locked.push_back(pred);
+                prevPred = pred;
+            }
+            valid = !pred->marked.load(std::memory_order_acquire) &&
+                    (succ == nullptr || !succ->marked.load(std::memory_order_acquire)) &&
+                    pred->next[level].load(std::memory_order_acquire) == succ;
+        }
+        if (!valid)
+        {
+            unlockAll(locked);
+            continue;
+        }
+
+        Node* newNode = new Node(value, topLevel + 1);
+        for (int level = 0; level <= topLevel; level++)
+        {
+            newNode->next[level].store(succs[level], std::memory_order_relaxed);
+        }
+        for (int level = 0; level <= topLevel; level++)
+        {
+            preds[level]->next[level].store(newNode, std::memory_order_release);
+        }
+        newNode->fullyLinked.store(true, std::memory_order_release);
+        count.fetch_add(1, std::memory_order_relaxed);
+        unlockAll(locked);
+        return true;
+    }
+}
+
+bool ConcurrentSkipList::insertAfter(int targetValue, int newValue)
+{
+    // В упорядоченном множестве место вставки определяется значением
+    (void)targetValue;
+    return insert(newValue);
+}
+
+bool ConcurrentSkipList::remove(int value)
+{
+    auto guard = EpochDomain::instance().pin();
+    Node* victim = nullptr;
+    bool isMarked = false;
+    int topLevel = -1;
+    Node* preds[MAX_LEVEL];
+    Node* succs[MAX_LEVEL];
+    std::vector<Node*> locked;
+
+    while (true)
+    {
+        int found = locate(value, preds, succs);
+        if (!isMarked)
+        {
+            // Удалять можно только полностью связанный узел, найденный
+            // на его собственном верхнем уровне
+            if (found == -1)
+            {
+                return false;
+            }
+            victim = succs[found];
+            if (!victim->fullyLinked.load(std::memory_order_acquire) ||
+                victim->topLevel != found ||
+                victim->marked.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            topLevel = victim->topLevel;
+            victim->mtx.lock();
+            if (victim->marked.load(std::memory_order_acquire))
+            {
+                victim->mtx.unlock();
+                return false;
+            }
+            victim->marked.store(true, std::memory_order_release);
+            isMarked = true;
+        }
+
+        bool valid = true;
+        Node* prevPred = nullptr;
+        for (int level = 0; valid && level <= topLevel; level++)
+        {
+            Node* pred = preds[level];
+            if (pred != prevPred)
+            {
+                pred->mtx.lock();
+                locked.push_back(pred);
+                prevPred = pred;
+            }
+            valid = !pred->marked.load(std::memory_order_acquire) &&
+                    pred->next[level].load(std::memory_order_acquire) == victim;
+        }
+        if (!valid)
+        {
+            unlockAll(locked);
+            continue;
+        }
+
+        for (int level = topLevel; level >= 0; level--)
+        {
+            preds[level]->next[level].store(victim->next[level].load(std::memory_order_relaxed),
+                                            std::memory_order_release);
+        }
+        count.fetch_sub(1, std::memory_order_relaxed);
+        victim->mtx.unlock();
+        unlockAll(locked);
+        EpochDomain::instance().retire(victim);
+        return true;
+    }
+}
+
+bool ConcurrentSkipList::find(int value)
+{
+    auto guard = EpochDomain::instance().pin();
+    Node* node = lowerBound(value);
+    return node != nullptr && node->value == value &&
+           node->fullyLinked.load(std::memory_order_acquire) &&
+           !node->marked.load(std::memory_order_acquire);
+}
+
+void ConcurrentSkipList::View::Iterator::skipMarked()
+{
+    while (node != nullptr &&
+           (node->marked.load(std::memory_order_acquire) || !node->fullyLinked.load(std::memory_order_acquire)))
+    {
+        node = node->next[0].load(std::memory_order_acquire);
+    }
+    if (node != nullptr && node->value > hi)
+    {
+        node = nullptr;
+    }
+}
+
+ConcurrentSkipList::View::Iterator& ConcurrentSkipList::View::Iterator::operator++()
+{
+    node = node->next[0].load(std::memory_order_acquire);
+    skipMarked();
+    return *this;
+}
+
+ConcurrentSkipList::View::View(const ConcurrentSkipList& list, int lo, int h)
+    : guard(EpochDomain::instance().pin()), first(list.lowerBound(lo)), hi(h) {}
+
+ConcurrentSkipList::View ConcurrentSkipList::ordered(int lo, int hi) const
+{
+    return View(*this, lo, hi);
+}
+
+std::vector<int> ConcurrentSkipList::range(int lo, int hi) const
+{
+    std::vector<int> values;
+    for (int value : ordered(lo, hi))
+    {
+        values.push_back(value);
+    }
+    return values;
+}
+
+void ConcurrentSkipList::print() const
+{
+    std::vector<int> values = range(INT_MIN, INT_MAX);
+    std::cout << "List: ";
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        std::cout << values[i];
+        if (i + 1 < values.size())
+        {
+            std::cout << " -> ";
+        }
+    }
+    std::cout << " -> NULL" << std::endl;
+}
+
+int ConcurrentSkipList::size() const
+{
+    return count.load(std::memory_order_relaxed);
+}
+
+bool ConcurrentSkipList::empty() const
+{
+    return size() == 0;
+}
@@ -0,0 +1,107 @@
+#ifndef SKIPLIST_H
+#define SKIPLIST_H
+
+#include <atomic>
+#include <climits>
+#include <mutex>
+#include <vector>
+#include "EpochDomain.h"
+
+// Конкурентный skip list (lazy skip list, Herlihy-Lev-Luchangco-Shavit):
+// упорядоченное множество с поиском за O(log n).
+//
+// Как и в LazyList, у каждого узла своя блокировка и флаг marked.
+// insert/remove спускаются по уровням без блокировок, затем захватывают
+// предшественников на всех уровнях узла и проверяют, что ссылки не
+// изменились. Узел становится видимым для find после fullyLinked, т.е.
+// когда связаны все его уровни. find не берет блокировок.
+// Вырезанные узлы освобождаются через EpochDomain.
+class ConcurrentSkipList
+{
+public:
+    static constexpr int MAX_LEVEL = 20;
+
+private:
+    struct Node
+    {
+        int value;
+        int topLevel;
+        std::atomic<Node*>* next;          // topLevel + 1 ссылок
+        std::atomic<bool> marked;
+        std::atomic<bool> fullyLinked;
+        std::mutex mtx;
+
+        Node(int val, int levels) : value(val), topLevel(levels - 1),
+            next(new std::atomic<Node*>[levels]), marked(false), fullyLinked(false)
+        {
+            for (int i = 0; i < levels; i++)
+            {
+                next[i].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+        ~Node() { delete[] next; }
+    };
+
+    Node head;                              // Фиктивный узел высоты MAX_LEVEL
+    std::atomic<int> count{0};
+
+    static int randomLevel();
+
+    // Заполняет preds/succs на каждом уровне и возвращает старший уровень,
+    // на котором найден value, или -1. Вызывать под EpochDomain::Guard
+    int locate(int value, Node* preds[], Node* succs[]) const;
+
+    // Первый узел со значением >= value (нижний уровень), за O(log n)
+    Node* lowerBound(int value) const;
+
+    static void unlockAll(std::vector<Node*>& locked);
+
+public:
+    // Упорядоченный обход. Пока View жив, поток закреплен в EpochDomain,
+    // и узлы под итератором не освобождаются. Обход слабо согласованный:
+    // видны все элементы, присутствовавшие в течение всего обхода, а
+    // вставленные или удаленные во время обхода могут как попасть, так и нет
+    class View
+    {
+    private:
+        EpochDomain::Guard guard;
+        Node* first;
+        int hi;
+
+    public:
+        class Iterator
+        {
+        private:
+            Node* node;
+            int hi;
+            void skipMarked();
+        public:
+            Iterator(Node* n, int h) : node(n), hi(h) { skipMarked(); }
+            int operator*() const { return node->value; }
+            Iterator& operator++();
+            bool operator==(const Iterator& other) const { return node == other.node; }
+            bool operator!=(const Iterator& other) const { return node != other.node; }
+        };
+
+        View(const ConcurrentSkipList& list, int lo, int hi);
+        Iterator begin() const { return Iterator(first, hi); }
+        Iterator end() const { return Iterator(nullptr, hi); }
+    };
+
+    ConcurrentSkipList();
+    ~ConcurrentSkipList();
+
+    bool insert(int value);                    // Вставка, false если значение уже есть
+    bool insertAfter(int targetValue, int newValue); // Позицию задает порядок, target не влияет
+    bool remove(int value);                    // Удаление по значению
+    bool find(int value);                      // Поиск без блокировок, O(log n)
+
+    View ordered(int lo = INT_MIN, int hi = INT_MAX) const; // Значения из [lo, hi] по возрастанию
+    std::vector<int> range(int lo, int hi) const;           // Копия значений из [lo, hi]
+
+    void print() const;                        // Вывод списка
+    int size() const;                          // Размер списка
+    bool empty() const;                        // Проверка на пустоту
+};
+
+#endif
@@ -0,0 +1,246 @@
+#include "StripedHashSet.h"
+#include <iostream>
+
+StripedHashSet::StripedHashSet(size_t stripeCount)
+    : table(new std::vector<Bucket>(stripeCount * INITIAL_BUCKETS_PER_STRIPE)),
+      oldTable(nullptr),
+      stripes(stripeCount)
+{
+    bucketsNow.store(table->size(), std::memory_order_relaxed);
+}
+
+StripedHashSet::~StripedHashSet()
+{
+    delete table;
+    delete oldTable;
+}
+
+uint32_t StripedHashSet::hash(int value)
+{
+    // Финальное перемешивание MurmurHash3: std::hash<int> тождественен,
+    // и близкие значения попадали бы в соседние корзины одной полосы
+    uint32_t h = static_cast<uint32_t>(value);
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+    return h;
+}
+
+void StripedHashSet::lockAll() const
+{
+    for (Stripe& stripe : stripes)
+    {
+        stripe.mtx.lock();
+    }
+}
+
+void StripedHashSet::unlockAll() const
+{
+    for (Stripe& stripe : stripes)
+    {
+        stripe.mtx.unlock();
+    }
+}
+
+void StripedHashSet::migrateLocked(size_t oldBucket)
+{
+    if (migrated[oldBucket])
+    {
+        return;
+    }
+    Bucket moving;
+    moving.swap((*oldTable)[oldBucket]);
+    for (int value : moving)
+    {
+        (*table)[hash(value) % table->size()].push_back(value);
+    }
+    migrated[oldBucket] = 1;
+    migratedCount.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void StripedHashSet::migrateForKey(uint32_t h)
+{
+    if (oldTable != nullptr)
+    {
+        migrateLocked(h % oldTable->size());
+    }
+}
+
+StripedHashSet::Bucket& StripedHashSet::bucketFor(uint32_t h)
+{
+    migrateForKey(h);
+    return (*table)[h % table->size()];
+}
+
+void StripedHashSet::maybeGrow()
+{
+    size_t buckets = bucketsNow.load(std::memory_order_relaxed);
+    if (oldBuckets.load(std::memory_order_relaxed) != 0 ||
+        size_t(count.load(std::memory_order_relaxed)) <= MAX_LOAD * buckets)
+    {
+        return;
+    }
+
+    // Под всеми полосами только выделяем новую таблицу - это O(размера),
+    // но без переноса элементов
+    lockAll();
+    if (oldTable == nullptr && size_t(count.load(std::memory_order_relaxed)) > MAX_LOAD * table->size())
+    {
+        oldTable = table;
+        table = new std::vector<Bucket>(oldTable->size() * 2);
+        migrated.assign(oldTable->size(), 0);
+        migratedCount.store(0, std::memory_order_relaxed);
+        migrateCursor.store(0, std::memory_order_relaxed);
+        bucketsNow.store(table->size(), std::memory_order_relaxed);
+        oldBuckets.store(oldTable->size(), std::memory_order_release);
+    }
+    unlockAll();
+}
+
+void StripedHashSet::helpMigrate()
+{
+    size_t total = oldBuckets.load(std::memory_order_acquire);
+    if (total == 0)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < HELP_STEP; i++)
+    {
+        size_t b = migrateCursor.fetch_add(1, std::memory_order_relaxed);
+        if (b >= total)
+        {
+            break;
+        }
+        // Курсор мог остаться от прошлого переноса - проверяем под полосой
+        std::lock_guard<ProfiledMutex> lock(stripes[b % stripes.size()].mtx);
+        if (oldTable != nullptr && b < oldTable->size())
+        {
+            migrateLocked(b);
+        }
+    }
+
+    if (migratedCount.load(std::memory_order_acquire) == total)
+    {
+        lockAll();
+        if (oldTable != nullptr && migratedCount.load(std::memory_order_relaxed) == oldTable->size())
+        {
+            delete oldTable;
+            oldTable = nullptr;
+            migrated.clear();
+            oldBuckets.store(0, std::memory_order_release);
+        }
+        unlockAll();
+    }
+}
+
+bool StripedHashSet::insert(int value)
+{
+    uint32_t h = hash(value);
+    {
+        std::lock_guard<ProfiledMutex> lock(stripes[stripeOf(h)].mtx);
+        Bucket& bucket = bucketFor(h);
+        for (int v : bucket)
+        {
+            if (v == value)
+            {
+                return false;
+            }
+        }
+        bucket.push_back(value);
+        count.fetch_add(1, std::memory_order_relaxed);
+    }
+    helpMigrate();
+    maybeGrow();
+    return true;
+}
+
+bool StripedHashSet::insertAfter(int targetValue, int newValue)
+{
+    // В хеш-множестве нет порядка, место вставки определяется хешем
+    (void)targetValue;
+    return insert(newValue);
+}
+
+bool StripedHashSet::remove(int value)
+{
+    uint32_t h = hash(value);
+    bool removed = false;
+    {
+        std::lock_guard<ProfiledMutex> lock(stripes[stripeOf(h)].mtx);
+        Bucket& bucket = bucketFor(h);
+        for (size_t i = 0; i < bucket.size(); i++)
+        {
+            if (bucket[i] == value)
+            {
+                bucket[i] = bucket.back();
+                bucket.pop_back();
+                count.fetch_sub(1, std::memory_order_relaxed);
+                removed = true;
+                break;
+            }
+        }
+    }
+    helpMigrate();
+    return removed;
+}
+
+bool StripedHashSet::find(int value)
+{
+    uint32_t h = hash(value);
+    std::lock_guard<ProfiledMutex> lock(stripes[stripeOf(h)].mtx);
+    for (int v : bucketFor(h))
+    {
+        if (v == value)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void StripedHashSet::print() const
+{
+    std::vector<int> values;
+    lockAll();
+    if (oldTable != nullptr)
+    {
+        for (const Bucket& bucket : *oldTable)
+        {
+            values.insert(values.end(), bucket.begin(), bucket.end());
+        }
+    }
+    for (const Bucket& bucket : *table)
+    {
+        values.insert(values.end(), bucket.begin(), bucket.end());
+    }
+    unlockAll();
+
+    std::cout << "Set: {";
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        std::cout << values[i];
+        if (i + 1 < values.size())
+        {
+            std::cout << ", ";
+        }
+    }
+    std::cout << "}" << std::endl;
+}
+
+int StripedHashSet::size() const
+{
+    return count.load(std::memory_order_relaxed);
+}
+
+bool StripedHashSet::empty() const
+{
+    return size() == 0;
+}
+
+size_t StripedHashSet::bucketCount() const
+{
+    return bucketsNow.load(std::memory_order_relaxed);
+}
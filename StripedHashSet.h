@@ -0,0 +1,82 @@
+#ifndef STRIPEDHASHSET_H
+#define STRIPEDHASHSET_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "LockProfiler.h"
+
+// Конкурентное хеш-множество с разделенными блокировками (lock striping).
+//
+// Число блокировок (полос) задается при создании и не меняется, а таблица
+// корзин растет независимо от него: корзина b защищена полосой b % stripes.
+// Размер таблицы всегда кратен числу полос, поэтому при удвоении корзины
+// b и b + oldSize новой таблицы попадают в ту же полосу, что и корзина b
+// старой, и перенос корзины требует только одной блокировки.
+//
+// Рост таблицы кооперативный и постепенный: под всеми блокировками лишь
+// выделяется новая таблица, а переносят корзины сами операции - каждая
+// переносит корзину, к которой обращается, и помогает еще с несколькими.
+// Когда перенесено все, старая таблица освобождается.
+class StripedHashSet
+{
+private:
+    static constexpr size_t INITIAL_BUCKETS_PER_STRIPE = 1;
+    static constexpr size_t MAX_LOAD = 4;          // Элементов на корзину до роста
+    static constexpr size_t HELP_STEP = 2;         // Корзин, переносимых "в помощь" за операцию
+
+    // Все полосы пишут в одну запись профилировщика
+    struct alignas(64) Stripe
+    {
+        ProfiledMutex mtx{"StripedHashSet::stripe"};
+    };
+
+    using Bucket = std::vector<int>;
+
+    // Поля ниже меняются только под всеми полосами, а читаются под любой
+    std::vector<Bucket>* table;
+    std::vector<Bucket>* oldTable;                 // Не nullptr, пока идет перенос
+    std::vector<uint8_t> migrated;                 // Перенесена ли корзина oldTable
+
+    mutable std::vector<Stripe> stripes;
+    std::atomic<size_t> bucketsNow{0};            // Копии размеров для проверок
+    std::atomic<size_t> oldBuckets{0};            // без блокировок; 0 - переноса нет
+    std::atomic<size_t> migratedCount{0};
+    std::atomic<size_t> migrateCursor{0};
+    std::atomic<int> count{0};
+
+    static uint32_t hash(int value);
+    size_t stripeOf(uint32_t h) const { return h % stripes.size(); }
+
+    void lockAll() const;
+    void unlockAll() const;
+
+    // Под полосой корзины: переносит корзину старой таблицы, если нужно
+    void migrateLocked(size_t oldBucket);
+    void migrateForKey(uint32_t h);
+    Bucket& bucketFor(uint32_t h);
+
+    void maybeGrow();
+    void helpMigrate();
+
+public:
+    explicit StripedHashSet(size_t stripeCount = 16);
+    ~StripedHashSet();
+
+    StripedHashSet(const StripedHashSet&) = delete;
+    StripedHashSet& operator=(const StripedHashSet&) = delete;
+
+    bool insert(int value);                    // Вставка, false если значение уже есть
+    bool insertAfter(int targetValue, int newValue); // Порядка нет, target не влияет
+    bool remove(int value);                    // Удаление по значению
+    bool find(int value);                      // Поиск элемента
+
+    void print() const;                        // Вывод множества
+    int size() const;                          // Число элементов
+    bool empty() const;                        // Проверка на пустоту
+    size_t bucketCount() const;                // Текущее число корзин
+};
+
+#endif
@@ -7,59 +7,138 @@
 #include <string>
 #include <map>
 #include "LiveCounter.h"
+#include "LockProfiler.h"
+#include "SeqLock.h"
+#include "RcuCell.h"
 
+// Способ разделения значения между писателем и читателями
+enum class Mode { SharedMutex, SeqLock, Rcu };
+
+// Конфигурация для режима rcu: несколько связанных полей, которые
+// читатель должен видеть согласованными, и строка - в seqlock не влезет
+struct Config {
+    int value = 0;
+    int square = 0;
+    int doubled = 0;
+    int plus2 = 0;
+    std::string label = "v0";
+};
+
+Config make_config(int value) {
+    return Config{value, value * value, value * 2, value + 2, "v" + std::to_string(value)};
+}
+
+Mode mode = Mode::SharedMutex;
 int shared_value = 0;
-std::shared_mutex shared_mutex;
+ProfiledSharedMutex shared_mutex{"Task1::shared_mutex"};
+SeqLock<int> published_value{0};
+RcuCell<Config> shared_config{make_config(0)};
+std::atomic<long long> torn_reads{0};
 std::atomic<bool> running{true};
+std::atomic<long long> total_reads{0};
 LiveCounter live_counter;
 
+int read_value() {
+    if (mode == Mode::SeqLock) {
+        return published_value.load();
+    }
+    if (mode == Mode::Rcu) {
+        auto config = shared_config.read();
+        if (config->square != config->value * config->value || config->doubled != config->value * 2 ||
+            config->plus2 != config->value + 2 || config->label != "v" + std::to_string(config->value)) {
+            torn_reads.fetch_add(1, std::memory_order_relaxed);
+        }
+        return config->value;
+    }
+    std::shared_lock lock(shared_mutex);
+    return shared_value;
+}
+
+// Писатель готовит новое значение 200 мс. С shared_mutex он держит
+// блокировку все это время, а в seqlock и rcu публикуется уже готовое значение
+int write_next_value() {
+    if (mode == Mode::SeqLock) {
+        int next = published_value.load() + 1;
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        published_value.store(next);
+        return next;
+    }
+    if (mode == Mode::Rcu) {
+        Config next = make_config(shared_config.read()->value + 1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        int current_value = next.value;
+        shared_config.store(std::move(next));
+        return current_value;
+    }
+    std::unique_lock lock(shared_mutex);
+    shared_value++;
+    int current_value = shared_value;
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    return current_value;
+}
+
 void reader_square() {
+    LiveCounter::Handle key = live_counter.register_key("square");
+    LiveCounter::Format format = live_counter.register_format("[Square] {}^2 = {}");
+    long long reads = 0;
     while (running.load(std::memory_order_acquire)) {
-        std::shared_lock lock(shared_mutex);
-        int value = shared_value;
-        lock.unlock();
+        int value = read_value();
+        reads++;
         
-        live_counter.update("square", "[Square] " + std::to_string(value) + "^2 = " + 
-                                   std::to_string(value * value));
+        live_counter.update(key, format, value, value * value);
     }
+    total_reads += reads;
 }
 
 void reader_double() {
+    LiveCounter::Handle key = live_counter.register_key("double");
+    LiveCounter::Format format = live_counter.register_format("[Double] {} * 2 = {}");
+    long long reads = 0;
     while (running.load(std::memory_order_acquire)) {
-        std::shared_lock lock(shared_mutex);
-        int value = shared_value;
-        lock.unlock();
+        int value = read_value();
+        reads++;
         
-        live_counter.update("double", "[Double] " + std::to_string(value) + " * 2 = " + 
-                                   std::to_string(value * 2));
+        live_counter.update(key, format, value, value * 2);
     }
+    total_reads += reads;
 }
 
 void reader_plus2() {
+    LiveCounter::Handle key = live_counter.register_key("plus2");
+    LiveCounter::Format format = live_counter.register_format("[Plus2] {} + 2 = {}");
+    long long reads = 0;
     while (running.load(std::memory_order_acquire)) {
-        std::shared_lock lock(shared_mutex);
-        int value = shared_value;
-        lock.unlock();
+        int value = read_value();
+        reads++;
         
-        live_counter.update("plus2", "[Plus2] " + std::to_string(value) + " + 2 = " + 
-                                  std::to_string(value + 2));
+        live_counter.update(key, format, value, value + 2);
     }
+    total_reads += reads;
 }
 
 void writer() {
+    LiveCounter::Handle key = live_counter.register_key("writer");
+    LiveCounter::Format format = live_counter.register_format(">>> Writer: shared_value = {}");
     while (running.load(std::memory_order_acquire)) {
-        std::unique_lock lock(shared_mutex);
-        shared_value++;
-        int current_value = shared_value;
-        std::this_thread::sleep_for(std::chrono::milliseconds(200));
-        lock.unlock();
+        int current_value = write_next_value();
         
-        live_counter.update("writer", ">>> Writer: shared_value = " + std::to_string(current_value));
+        live_counter.update(key, format, current_value);
         std::this_thread::sleep_for(std::chrono::milliseconds(20));
     }
 }
 
-int main() {
+int main(int argc, char* argv[]) {
+    // Режим: shared_mutex (по умолчанию), seqlock или rcu
+    std::string mode_name = argc > 1 ? argv[1] : "shared_mutex";
+    if (mode_name == "seqlock") {
+        mode = Mode::SeqLock;
+    } else if (mode_name == "rcu") {
+        mode = Mode::Rcu;
+    } else if (mode_name != "shared_mutex") {
+        std::cerr << "Unknown mode: " << mode_name << " (expected: shared_mutex, seqlock, rcu)" << std::endl;
+        return 1;
+    }
+    
     live_counter.init_display();
     
     std::thread writer_thread(writer);
@@ -74,7 +153,13 @@ int main() {
     reader1_thread.join();
     reader2_thread.join();
     reader3_thread.join();
+    live_counter.shutdown();
     
     std::cout << "\033[10;1H\nProgram finished!\n";  
+    std::cout << "Mode: " << mode_name << " | Reads: " << total_reads.load();
+    if (mode == Mode::Rcu) {
+        std::cout << " | Inconsistent: " << torn_reads.load();
+    }
+    std::cout << std::endl;
     return 0;
 }
\ No newline at end of file
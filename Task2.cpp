@@ -2,113 +2,103 @@
 #include <thread>
 #include <atomic>
 #include <chrono>
-#include <mutex>
-#include <semaphore>
+#include <string>
+#include <vector>
+#include <algorithm>
 #include "LiveCounter.h"
+#include "Broadcast.h"
 
 int shared_value = 0;
 std::atomic<bool> running{true};
 LiveCounter live_counter;
 
-// Семафоры для синхронизации
+// Писатель публикует поколения, каждый из N читателей обрабатывает каждое
+// поколение ровно один раз, и только потом писатель меняет значение снова
+Broadcast* broadcast = nullptr;
+std::vector<long long> reads_per_reader;    // Каждый читатель пишет только свой элемент
 
-std::counting_semaphore<3> reader_sem{0};    // Разрешения для читателей
-std::counting_semaphore<1> writer_sem{1};    // Разрешение для писателя
-std::atomic<int> readers_done{0};            // Счетчик завершивших читателей
-
-void reader_square() 
+// Роли читателей повторяются по кругу: square, double, plus2
+void reader(int id)
 {
-    while (running.load(std::memory_order_acquire)) 
-    {
-        // Ждем разрешения от писателя
-        reader_sem.acquire();
-        
-        // Читаем значение
-        int value = shared_value;
-        live_counter.update("square", "[Square] " + std::to_string(value) + "^2 = " + 
-                                   std::to_string(value * value));
-        
-        readers_done++;
-        
-        if (readers_done == 3) {
-            writer_sem.release();
-        }
-    }
-}
+    static const char* const keys[] = {"square", "double", "plus2"};
+    static const char* const patterns[] = {"[Square] {}^2 = {}", "[Double] {} * 2 = {}", "[Plus2] {} + 2 = {}"};
+    int role = id % 3;
+    LiveCounter::Handle key = live_counter.register_key(keys[role]);
+    LiveCounter::Format format = live_counter.register_format(patterns[role]);
 
-void reader_double() 
-{
-    while (running.load(std::memory_order_acquire)) 
+    uint32_t seen = 0;
+    while (broadcast->await(seen))
     {
-        reader_sem.acquire();
-        
+        // Читаем значение: писатель не тронет его, пока все не вызовут consume
         int value = shared_value;
-        live_counter.update("double", "[Double] " + std::to_string(value) + " * 2 = " + 
-                                   std::to_string(value * 2));
-        
-        readers_done++;
-        if (readers_done == 3) {
-            writer_sem.release();
+        switch (role) {
+            case 0: live_counter.update(key, format, value, value * value); break;
+            case 1: live_counter.update(key, format, value, value * 2); break;
+            default: live_counter.update(key, format, value, value + 2); break;
         }
-    }
-}
+        reads_per_reader[id]++;
 
-void reader_plus2() 
-{
-    while (running.load(std::memory_order_acquire)) 
-    {
-        reader_sem.acquire();
-        
-        int value = shared_value;
-        live_counter.update("plus2", "[Plus2] " + std::to_string(value) + " + 2 = " + 
-                                  std::to_string(value + 2));
-        
-        readers_done++;
-        if (readers_done == 3) {
-            writer_sem.release();
-        }
+        broadcast->consume(id);
     }
 }
 
-void writer() 
+void writer()
 {
-    while (running.load(std::memory_order_acquire)) 
+    LiveCounter::Handle key = live_counter.register_key("writer");
+    LiveCounter::Format format = live_counter.register_format(">>> Writer: shared_value = {}");
+    // Ждем, пока все читатели обработают прошлое поколение
+    while (running.load(std::memory_order_acquire) && broadcast->waitConsumed())
     {
-        // Ждем своего разрешения
-        writer_sem.acquire();
-        
-        if (!running) break;
-        
         shared_value++;
-        live_counter.update("writer", ">>> Writer: shared_value = " + std::to_string(shared_value));
-        
-        readers_done = 0;
-        reader_sem.release(3); 
-        
+        live_counter.update(key, format, shared_value);
+
+        broadcast->publish();
+
         // Небольшая задержка для наглядности
         std::this_thread::sleep_for(std::chrono::milliseconds(200));
     }
 }
 
-int main() {
+int main(int argc, char* argv[]) {
+    // Число читателей (по умолчанию 3)
+    int readers = 3;
+    if (argc > 1) {
+        try {
+            readers = std::stoi(argv[1]);
+        } catch (const std::exception&) {
+            readers = 0;
+        }
+    }
+    if (readers < 1) {
+        std::cerr << "Usage: Task2 [readers]" << std::endl;
+        std::cerr << "Reader count must be a positive integer" << std::endl;
+        return 1;
+    }
+    Broadcast barrier(readers);
+    broadcast = &barrier;
+    reads_per_reader.assign(readers, 0);
+
     live_counter.init_display();
-    
+
     std::thread writer_thread(writer);
-    std::thread reader1_thread(reader_square);
-    std::thread reader2_thread(reader_double);
-    std::thread reader3_thread(reader_plus2);
-    
+    std::vector<std::thread> reader_threads;
+    for (int i = 0; i < readers; i++) {
+        reader_threads.emplace_back(reader, i);
+    }
+
     std::this_thread::sleep_for(std::chrono::seconds(10));
     running.store(false, std::memory_order_release);
-    
-    writer_sem.release();
-    reader_sem.release(3);
-    
+
     writer_thread.join();
-    reader1_thread.join();
-    reader2_thread.join();
-    reader3_thread.join();
-    
+    barrier.close();
+    for (auto& t : reader_threads) {
+        t.join();
+    }
+    live_counter.shutdown();
+
+    auto [min_reads, max_reads] = std::minmax_element(reads_per_reader.begin(), reads_per_reader.end());
     std::cout << "\033[10;1H\nProgram finished!\n";
+    std::cout << "Readers: " << readers << " | Generations: " << shared_value
+              << " | Reads per reader: " << *min_reads << ".." << *max_reads << std::endl;
     return 0;
-}
\ No newline at end of file
+}
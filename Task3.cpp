@@ -7,15 +7,30 @@
 #include <mutex>
 #include <vector>
 #include "LiveCounter.h"
+#include "LockProfiler.h"
 
 class Pipeline 
 {
 private:
     std::queue<int> queue1, queue2, queue3;
-    std::mutex mtx1, mtx2, mtx3;
-    std::condition_variable cv1, cv2, cv3;
+    ProfiledMutex mtx1{"Pipeline::mtx1"}, mtx2{"Pipeline::mtx2"}, mtx3{"Pipeline::mtx3"};
+    std::condition_variable_any cv1, cv2, cv3;
     std::atomic<bool> running{true};
     LiveCounter live_counter;
+    LiveCounter::Handle writer_key = live_counter.register_key("writer");
+    LiveCounter::Handle square_key = live_counter.register_key("square");
+    LiveCounter::Handle double_key = live_counter.register_key("double");
+    LiveCounter::Handle plus2_key = live_counter.register_key("plus2");
+    LiveCounter::Handle final_key = live_counter.register_key("final");
+    LiveCounter::Format writer_produced = live_counter.register_format(">>> Writer: produced [{}]");
+    LiveCounter::Format writer_waiting = live_counter.register_format(">>> Writer: waiting...");
+    LiveCounter::Format square_processing = live_counter.register_format("[Stage1-Square] processing [{}]");
+    LiveCounter::Format square_waiting = live_counter.register_format("[Stage1-Square] waiting...");
+    LiveCounter::Format double_processing = live_counter.register_format("[Stage2-Double] processing [{}]");
+    LiveCounter::Format double_waiting = live_counter.register_format("[Stage2-Double] waiting...");
+    LiveCounter::Format plus2_processing = live_counter.register_format("[Stage3-Plus2]  processing [{}]");
+    LiveCounter::Format plus2_waiting = live_counter.register_format("[Stage3-Plus2]  waiting...");
+    LiveCounter::Format final_result = live_counter.register_format("[FINAL] Result: {}");
     
     std::atomic<int> current_value{0};
     std::atomic<int> stage1_value{0};
@@ -123,7 +138,7 @@ public:
             int result = value + 2;
             
             stage3_value.store(0, std::memory_order_release);
-            live_counter.update("final", "[FINAL] Result: " + std::to_string(result));
+            live_counter.update(final_key, final_result, result);
         }
     }
     
@@ -134,17 +149,27 @@ public:
         int s2 = stage2_value.load(std::memory_order_acquire); 
         int s3 = stage3_value.load(std::memory_order_acquire);
         
-        std::string writer_status = ">>> Writer: ";
         if (current > 0) {
-            writer_status += "produced [" + std::to_string(current) + "]";
+            live_counter.update(writer_key, writer_produced, current);
         } else {
-            writer_status += "waiting...";
+            live_counter.update(writer_key, writer_waiting);
         }
         
-        live_counter.update("writer", writer_status);
-        live_counter.update("square", "[Stage1-Square] " + (s1 > 0 ? "processing [" + std::to_string(s1) + "]" : "waiting..."));
-        live_counter.update("double", "[Stage2-Double] " + (s2 > 0 ? "processing [" + std::to_string(s2) + "]" : "waiting..."));
-        live_counter.update("plus2", "[Stage3-Plus2]  " + (s3 > 0 ? "processing [" + std::to_string(s3) + "]" : "waiting..."));
+        if (s1 > 0) {
+            live_counter.update(square_key, square_processing, s1);
+        } else {
+            live_counter.update(square_key, square_waiting);
+        }
+        if (s2 > 0) {
+            live_counter.update(double_key, double_processing, s2);
+        } else {
+            live_counter.update(double_key, double_waiting);
+        }
+        if (s3 > 0) {
+            live_counter.update(plus2_key, plus2_processing, s3);
+        } else {
+            live_counter.update(plus2_key, plus2_waiting);
+        }
     }
     
     void run() 
@@ -167,6 +192,7 @@ public:
         reader1_thread.join();
         reader2_thread.join();
         reader3_thread.join();
+        live_counter.shutdown();
         
         std::cout << "\033[7;1H\nPipeline processing finished!\n";
     }
@@ -6,11 +6,94 @@
 #include <random>
 #include <string>
 #include <mutex>
+#include <iomanip>
+#include <memory>
+#include <optional>
+#include <algorithm>
+#include <type_traits>
+#include <stdexcept>
 #include "LinkedList.h"
+#include "FineGrainedList.h"
+#include "LockFreeList.h"
+#include "LazyList.h"
+#include "SkipList.h"
+#include "StripedHashSet.h"
+#include "UnrolledList.h"
+#include "EpochDomain.h"
+#include "HazardDomain.h"
+#include "HistoryRecorder.h"
+#include "Linearizability.h"
+#include "Workload.h"
+#include "LatencyHistogram.h"
+#include "LockProfiler.h"
 
+// Спецификация для проверки линеаризуемости: списки с void insert хранят
+// повторы, списки с bool insert - множества
+template<typename List>
+constexpr ListModel model_of() {
+    if constexpr (std::is_void_v<decltype(std::declval<List&>().insert(0))>) {
+        return ListModel::Multiset;
+    } else {
+        return ListModel::Set;
+    }
+}
+
+// Строки отчета о задержках: перцентили в наносекундах
+// count_label - что считает столбец: все операции или только выборку
+void print_latency_header(const char* count_label = "count") {
+    std::cout << std::left << std::setw(16) << "Operation" << std::right
+              << std::setw(12) << count_label << std::setw(10) << "p50"
+              << std::setw(10) << "p99" << std::setw(10) << "p99.9"
+              << std::setw(12) << "max" << std::endl;
+}
+
+void print_latency_row(const std::string& name, const LatencyHistogram& histogram) {
+    std::cout << std::left << std::setw(16) << name << std::right
+              << std::setw(12) << histogram.count()
+              << std::setw(10) << histogram.percentile(50)
+              << std::setw(10) << histogram.percentile(99)
+              << std::setw(10) << histogram.percentile(99.9)
+              << std::setw(12) << histogram.max() << std::endl;
+}
+
+// Засекает время жизни объекта и записывает его в гистограмму
+struct LatencyTimer {
+    LatencyHistogram& histogram;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    
+    ~LatencyTimer() {
+        histogram.record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count());
+    }
+};
+
+// Печатает вердикт проверки; false, если история не линеаризуема или неполна
+bool report_linearizability(const HistoryRecorder& recorder, ListModel model, const std::vector<int>& initial) {
+    if (recorder.dropped() > 0) {
+        std::cout << "Linearizability: history buffers overflowed (" << recorder.dropped()
+                  << " ops dropped), check skipped" << std::endl;
+        return false;
+    }
+    auto start = std::chrono::steady_clock::now();
+    LinearizabilityResult result = checkLinearizability(recorder.collect(), model, initial);
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    
+    std::cout << "Linearizability: " << (result.linearizable ? "OK" : "VIOLATION")
+              << " | Ops: " << result.operations
+              << " | Keys: " << result.partitions
+              << " | States: " << result.statesExplored
+              << " | Check time: " << elapsed.count() << " ms" << std::endl;
+    if (!result.linearizable) {
+        std::cout << result.details << std::endl;
+    }
+    return result.linearizable;
+}
+
+template<typename List>
 class ListTester {
 private:
-    LinkedList list;
+    List list;
+    std::string variant;
     std::atomic<bool> running{true};
     std::atomic<int> total_operations{0};
     
@@ -19,14 +102,32 @@ private:
         std::string details;
         std::atomic<int> operations{0};
         std::mutex mtx;
+        // Задержки операций над списком по видам OpType; пишет только
+        // сам поток, читаются после его завершения
+        LatencyHistogram latency[4];
     };
     
     std::vector<ThreadState> thread_states;
-    std::mutex display_mtx;
+    ProfiledMutex display_mtx{"ListTester::display_mtx"};
     bool display_initialized{false};
     
+    // Если задан, все операции потоков записываются для проверки линеаризуемости
+    HistoryRecorder* recorder;
+    
+    // Выполняет операцию над списком, замеряя ее задержку и при
+    // необходимости записывая в историю
+    template<typename Op>
+    auto recorded(int thread_id, OpType type, int value, int target, Op&& op) {
+        LatencyTimer timer{thread_states[thread_id].latency[int(type)]};
+        if (recorder == nullptr) {
+            return op();
+        }
+        return recorder->record(thread_id, type, value, target, std::forward<Op>(op));
+    }
+    
 public:
-    ListTester() : thread_states(5) {}
+    explicit ListTester(std::string variant_name, HistoryRecorder* history = nullptr)
+        : variant(std::move(variant_name)), thread_states(5), recorder(history) {}
     
     void clear_line(int line) {
         std::cout << "\033[" << line << ";1H";  // Перемещаем курсор на строку
@@ -43,7 +144,7 @@ public:
         std::cout << "\033[2J";  // Очищаем весь экран
         std::cout << "\033[1;1H"; // Курсор в начало
         
-        std::cout << "=== Thread-Safe Linked List Test ===\n";
+        std::cout << "=== Thread-Safe Linked List Test (" << variant << ") ===\n";
         std::cout << "Total operations: 0\n";
         std::cout << "List size: " << list.size() << "\n\n";
         
@@ -150,20 +251,20 @@ public:
                 switch (op) {
                     case 0: {
                         update_thread_state(id, "INSERT", "Inserting " + std::to_string(value) + " at head");
-                        list.insert(value);
+                        recorded(id, OpType::Insert, value, 0, [&] { return list.insert(value); });
                         update_thread_state(id, "WAITING", "Insert completed");
                         break;
                     }
                     case 1: {
                         int target = value_dis(gen) % 50 + 1;
                         update_thread_state(id, "INSERT_AFTER", "Inserting " + std::to_string(value) + " after " + std::to_string(target));
-                        list.insertAfter(target, value);
+                        recorded(id, OpType::InsertAfter, value, target, [&] { return list.insertAfter(target, value); });
                         update_thread_state(id, "WAITING", "InsertAfter completed");
                         break;
                     }
                     case 2: {
                         update_thread_state(id, "REMOVE", "Removing value " + std::to_string(value));
-                        bool removed = list.remove(value);
+                        bool removed = recorded(id, OpType::Remove, value, 0, [&] { return list.remove(value); });
                         update_thread_state(id, "WAITING", removed ? "Remove SUCCESS" : "Remove FAILED - not found");
                         break;
                     }
@@ -192,7 +293,7 @@ public:
             
             try {
                 update_thread_state(thread_index, "SEARCH", "Searching for " + std::to_string(value));
-                bool found = list.find(value);
+                bool found = recorded(thread_index, OpType::Find, value, 0, [&] { return list.find(value); });
                 update_thread_state(thread_index, "WAITING", "Search " + std::to_string(value) + " = " + (found ? "FOUND" : "NOT FOUND"));
             } catch (const std::exception& e) {
                 update_thread_state(thread_index, "ERROR", std::string("Exception: ") + e.what());
@@ -252,14 +353,665 @@ public:
         std::cout << "Total operations: " << total_operations.load() << std::endl;
         std::cout << "Final list size: " << list.size() << std::endl;
         list.print();
+        
+        if constexpr (requires { List::allocationStats(); }) {
+            NodePoolStats stats = List::allocationStats();
+            std::cout << "Node allocations: " << stats.allocations
+                      << " | Frees: " << stats.deallocations
+                      << " | Slabs: " << stats.slabs
+                      << " | Pool refills: " << stats.refills
+                      << " | Pool flushes: " << stats.flushes << std::endl;
+        }
+        
+        // Гистограммы потоков объединяются по видам операций
+        const char* op_names[4] = {"insert", "insertAfter", "remove", "find"};
+        std::cout << "\n=== LATENCY (ns) ===\n";
+        print_latency_header();
+        for (int type = 0; type < 4; type++) {
+            LatencyHistogram merged;
+            for (auto& state : thread_states) {
+                merged.merge(state.latency[type]);
+            }
+            print_latency_row(op_names[type], merged);
+        }
+        
+        if (recorder != nullptr && !report_linearizability(*recorder, model_of<List>(), {10, 20, 30})) {
+            throw std::runtime_error("history is not linearizable");
+        }
         std::cout << "Test completed successfully!\n";
     }
 };
 
-int main() {
+template<typename List>
+void run_variant(const std::string& name, bool check) {
+    // За 10 секунд с паузами поток делает меньше сотни операций.
+    // Без --check буферы истории не выделяются
+    std::optional<HistoryRecorder> history;
+    if (check) {
+        history.emplace(5, 4096);
+    }
+    ListTester<List> tester(name, history ? &*history : nullptr);
+    tester.run_test();
+}
+
+// Сколько элементов добавила операция: LinkedList::insert ничего
+// не возвращает и вставляет всегда, остальные списки возвращают bool
+template<typename Op>
+int applied(Op&& op) {
+    if constexpr (std::is_void_v<std::invoke_result_t<Op>>) {
+        op();
+        return 1;
+    } else {
+        return op() ? 1 : 0;
+    }
+}
+
+struct StressResult {
+    long long operations = 0;
+    long long net_inserted = 0;
+};
+
+// Те же операции, что в ListTester::writer_thread и reader_thread,
+// но без пауз и вывода. on_tick вызывается из главного потока каждые 100 мс
+template<typename List, typename OnTick>
+StressResult hammer_list(List& list, int seconds, int writers, int readers, OnTick on_tick) {
+    std::atomic<bool> running{true};
+    std::atomic<long long> net_inserted{0};
+    std::atomic<long long> operations{0};
+    
+    auto writer = [&](int id) {
+        std::mt19937 gen(id + 1);
+        std::uniform_int_distribution<> value_dis(1, 100);
+        std::uniform_int_distribution<> op_dis(0, 2);
+        long long local_net = 0, local_ops = 0;
+        
+        while (running.load(std::memory_order_acquire)) {
+            int value = value_dis(gen);
+            switch (op_dis(gen)) {
+                case 0:
+                    local_net += applied([&] { return list.insert(value); });
+                    break;
+                case 1: {
+                    int target = value_dis(gen) % 50 + 1;
+                    local_net += applied([&] { return list.insertAfter(target, value); });
+                    break;
+                }
+                case 2:
+                    local_net -= list.remove(value) ? 1 : 0;
+                    break;
+            }
+            local_ops++;
+        }
+        net_inserted += local_net;
+        operations += local_ops;
+    };
+    
+    auto reader = [&](int id) {
+        std::mt19937 gen(100 + id);
+        std::uniform_int_distribution<> value_dis(1, 100);
+        long long local_ops = 0;
+        while (running.load(std::memory_order_acquire)) {
+            list.find(value_dis(gen));
+            local_ops++;
+        }
+        operations += local_ops;
+    };
+    
+    std::vector<std::thread> threads;
+    for (int i = 0; i < writers; i++) {
+        threads.emplace_back(writer, i);
+    }
+    for (int i = 0; i < readers; i++) {
+        threads.emplace_back(reader, i);
+    }
+    
+    for (int tick = 1; tick <= seconds * 10; tick++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        on_tick(tick);
+    }
+    
+    running.store(false, std::memory_order_release);
+    for (auto& t : threads) {
+        t.join();
+    }
+    return {operations.load(), net_inserted.load()};
+}
+
+// Нагрузочный тест EBR: узлы удаляются и освобождаются как можно чаще
+bool run_ebr_stress(int seconds) {
+    const int WRITERS = 3;
+    const int READERS = 2;
+    
+    LockFreeList<EpochReclaimer> list;
+    EpochDomain& domain = EpochDomain::instance();
+    
+    std::cout << "=== EBR stress: " << WRITERS << " writers, " << READERS 
+              << " readers, " << seconds << " s ===" << std::endl;
+    
+    StressResult result = hammer_list(list, seconds, WRITERS, READERS, [&](int tick) {
+        if (tick % 10 == 0) {
+            std::cout << "Epoch: " << domain.epoch() 
+                      << " | Retired: " << domain.retiredCount()
+                      << " | Freed: " << domain.freedCount()
+                      << " | Pending: " << domain.pendingCount() << std::endl;
+        }
+    });
+    
+    // Все потоки завершены - оставшийся мусор должен освободиться полностью
+    domain.synchronize();
+    
+    bool size_ok = result.net_inserted == list.size();
+    bool drained = domain.pendingCount() == 0;
+    
+    std::cout << "Total operations: " << result.operations << std::endl;
+    std::cout << "List size: " << list.size() << " (expected " << result.net_inserted << ")" << std::endl;
+    std::cout << "Retired: " << domain.retiredCount() << " | Freed: " << domain.freedCount() << std::endl;
+    std::cout << (size_ok && drained ? "EBR stress PASSED" : "EBR stress FAILED") << std::endl;
+    return size_ok && drained;
+}
+
+// Один прогон сравнения схем освобождения. pending() - сколько узлов
+// удалено, но еще не освобождено
+template<typename List, typename Pending>
+void reclaim_bench_row(const std::string& name, int seconds, Pending pending) {
+    const int WRITERS = 3;
+    const int READERS = 2;
+    
+    List list;
+    for (int i = 1; i <= 50; i++) {
+        list.insert(i * 2);
+    }
+    
+    uint64_t peak = 0;
+    StressResult result = hammer_list(list, seconds, WRITERS, READERS, [&](int) {
+        peak = std::max<uint64_t>(peak, pending());
+    });
+    
+    std::cout << std::left << std::setw(22) << name
+              << std::right << std::setw(14) << (long long)(result.operations / seconds)
+              << std::setw(16) << peak << std::endl;
+}
+
+// Накладные расходы EBR и hazard pointers против удаления под мьютексом:
+// LinkedList сразу возвращает удаленный узел в NodePool потока
+void run_reclaim_bench(int seconds) {
+    std::cout << "=== Reclamation overhead: 3 writers, 2 readers, " << seconds << " s per variant ===" << std::endl;
+    std::cout << std::left << std::setw(22) << "Variant"
+              << std::right << std::setw(14) << "ops/sec"
+              << std::setw(16) << "peak pending" << std::endl;
+    
+    reclaim_bench_row<LinkedList>("mutex + NodePool", seconds, [] { return uint64_t(0); });
+    
+    reclaim_bench_row<LockFreeList<EpochReclaimer>>("lock-free + EBR", seconds, [] {
+        return EpochDomain::instance().pendingCount();
+    });
+    EpochDomain::instance().synchronize();
+    
+    reclaim_bench_row<LazyList>("lazy list + EBR", seconds, [] {
+        return EpochDomain::instance().pendingCount();
+    });
+    EpochDomain::instance().synchronize();
+    
+    uint64_t hp_before = HazardDomain::instance().pendingCount();
+    reclaim_bench_row<LockFreeList<HazardReclaimer>>("lock-free + hazard", seconds, [hp_before] {
+        return HazardDomain::instance().pendingCount() - hp_before;
+    });
+    
+    std::cout << "Hazard retire list per thread: max " << HazardDomain::instance().maxRetiredPerThread()
+              << " (cap " << HazardDomain::RETIRE_CAP << ")" << std::endl;
+}
+
+// Поэлементные вызовы против пакетных на одинаковых пачках: каждый поток
+// вставляет пачку, ищет пачку случайных значений (в основном это обход всего
+// списка) и удаляет вставленное, поэтому размер списка не меняется
+void run_bulk_bench(int seconds) {
+    const int PRODUCERS = 3;
+    const int PREFILL = 1000;
+    const std::vector<int> burst_sizes = {1, 4, 16, 64};
+    
+    std::cout << "=== Bulk vs per-element LinkedList ops: " << PRODUCERS << " producers, "
+              << PREFILL << " prefilled values, " << seconds << " s per row ===" << std::endl;
+    std::cout << std::left << std::setw(8) << "Burst"
+              << std::right << std::setw(18) << "single elem/sec"
+              << std::setw(18) << "bulk elem/sec"
+              << std::setw(10) << "speedup" << std::endl;
+    
+    for (int burst : burst_sizes) {
+        long long rates[2] = {0, 0};
+        for (int bulk = 0; bulk < 2; bulk++) {
+            LinkedList list;
+            for (int i = 0; i < PREFILL; i++) {
+                list.insert(i);
+            }
+            
+            std::atomic<bool> running{true};
+            std::atomic<long long> elements{0};
+            auto producer = [&](int id) {
+                std::mt19937 gen(id + 1);
+                std::uniform_int_distribution<> value_dis(0, 2 * PREFILL);
+                std::vector<int> values(burst);
+                std::vector<int> queries(burst);
+                std::vector<bool> found;
+                long long local = 0;
+                
+                while (running.load(std::memory_order_acquire)) {
+                    for (int i = 0; i < burst; i++) {
+                        values[i] = value_dis(gen);
+                        queries[i] = value_dis(gen);
+                    }
+                    if (bulk) {
+                        list.insertBulk(values);
+                        list.findBulk(queries, found);
+                        list.removeBulk(values);
+                    } else {
+                        for (int v : values) list.insert(v);
+                        for (int v : queries) list.find(v);
+                        for (int v : values) list.remove(v);
+                    }
+                    local += burst;
+                }
+                elements += local;
+            };
+            
+            std::vector<std::thread> threads;
+            for (int i = 0; i < PRODUCERS; i++) {
+                threads.emplace_back(producer, i);
+            }
+            std::this_thread::sleep_for(std::chrono::seconds(seconds));
+            running.store(false, std::memory_order_release);
+            for (auto& t : threads) {
+                t.join();
+            }
+            rates[bulk] = elements.load() / seconds;
+        }
+        
+        std::cout << std::left << std::setw(8) << burst
+                  << std::right << std::setw(18) << rates[0]
+                  << std::setw(18) << rates[1]
+                  << std::setw(9) << std::fixed << std::setprecision(2)
+                  << (rates[0] > 0 ? double(rates[1]) / rates[0] : 0.0) << "x" << std::endl;
+        std::cout.unsetf(std::ios::fixed);
+    }
+}
+
+// Время одного полного обхода в наносекундах на элемент для трех операций.
+// Значения 0..n-1 вставляются в начало, поэтому 0 оказывается в самом конце:
+// find(-1) не находит ничего, insertAfter(0, -1) и remove(-1) доходят до конца
+template<typename List>
+void layout_bench_row(const std::string& name, int n) {
+    auto list = std::make_unique<List>();
+    for (int i = 0; i < n; i++) {
+        list->insert(i);
+    }
+    
+    // Сколько полных обходов нужно, чтобы прочитать ~50M элементов
+    int rounds = std::max(1, 50000000 / n);
+    auto ns_per_element = [&](auto&& op) {
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < rounds; r++) {
+            op();
+        }
+        auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+        return elapsed.count() / (double(rounds) * n);
+    };
+    
+    // Операции берут блокировку, поэтому компилятор не может их выбросить
+    double find_ns = ns_per_element([&] { list->find(-1); });
+    double modify_ns = ns_per_element([&] {
+        list->insertAfter(0, -1);
+        list->remove(-1);
+    }) / 2;
+    
+    std::cout << std::left << std::setw(12) << name << std::right << std::setw(10) << n
+              << std::fixed << std::setprecision(3)
+              << std::setw(14) << find_ns << std::setw(22) << modify_ns << std::endl;
+    std::cout.unsetf(std::ios::fixed);
+}
+
+// Проверка линеаризуемости под максимальной конкуренцией: 3 писателя и
+// 2 читателя без пауз делают фиксированное число операций над узким
+// диапазоном ключей, после чего записанная история проверяется целиком
+template<typename List>
+bool check_variant(const std::string& name, int ops_per_thread) {
+    const int WRITERS = 3;
+    const int READERS = 2;
+    const int KEYS = 16;
+    
+    List list;
+    std::vector<int> initial;
+    for (int i = 1; i <= KEYS; i += 3) {
+        list.insert(i);
+        initial.push_back(i);
+    }
+    
+    HistoryRecorder history(WRITERS + READERS, ops_per_thread);
+    auto writer = [&](int id) {
+        std::mt19937 gen(id + 1);
+        std::uniform_int_distribution<> value_dis(1, KEYS);
+        std::uniform_int_distribution<> op_dis(0, 2);
+        for (int i = 0; i < ops_per_thread; i++) {
+            int value = value_dis(gen);
+            switch (op_dis(gen)) {
+                case 0:
+                    history.record(id, OpType::Insert, value, 0, [&] { return list.insert(value); });
+                    break;
+                case 1: {
+                    int target = value_dis(gen);
+                    history.record(id, OpType::InsertAfter, value, target, [&] { return list.insertAfter(target, value); });
+                    break;
+                }
+                case 2:
+                    history.record(id, OpType::Remove, value, 0, [&] { return list.remove(value); });
+                    break;
+            }
+        }
+    };
+    auto reader = [&](int id) {
+        std::mt19937 gen(100 + id);
+        std::uniform_int_distribution<> value_dis(1, KEYS);
+        for (int i = 0; i < ops_per_thread; i++) {
+            int value = value_dis(gen);
+            history.record(WRITERS + id, OpType::Find, value, 0, [&] { return list.find(value); });
+        }
+    };
+    
+    std::vector<std::thread> threads;
+    for (int i = 0; i < WRITERS; i++) {
+        threads.emplace_back(writer, i);
+    }
+    for (int i = 0; i < READERS; i++) {
+        threads.emplace_back(reader, i);
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    
+    std::cout << std::left << std::setw(13) << name << std::right;
+    return report_linearizability(history, model_of<List>(), initial);
+}
+
+bool run_linearizability_check(int ops_per_thread) {
+    std::cout << "=== Linearizability check: 3 writers, 2 readers, " << ops_per_thread
+              << " ops per thread ===" << std::endl;
+    bool ok = true;
+    ok &= check_variant<LinkedList>("coarse", ops_per_thread);
+    ok &= check_variant<UnrolledList>("unrolled", ops_per_thread);
+    ok &= check_variant<FineGrainedList>("fine", ops_per_thread);
+    ok &= check_variant<LazyList>("lazy", ops_per_thread);
+    ok &= check_variant<ConcurrentSkipList>("skiplist", ops_per_thread);
+    ok &= check_variant<StripedHashSet>("hashset", ops_per_thread);
+    ok &= check_variant<LockFreeList<EpochReclaimer>>("lockfree", ops_per_thread);
+    ok &= check_variant<LockFreeList<HazardReclaimer>>("lockfree-hp", ops_per_thread);
+    std::cout << (ok ? "All variants linearizable" : "Linearizability check FAILED") << std::endl;
+    return ok;
+}
+
+// Узел на значение против узла на кэш-линию
+void run_unrolled_bench() {
+    std::cout << "=== Node-per-value vs unrolled layout, ns per element scanned ===" << std::endl;
+    std::cout << std::left << std::setw(12) << "Layout" << std::right << std::setw(10) << "Elements"
+              << std::setw(14) << "find" << std::setw(22) << "insertAfter/remove" << std::endl;
+    for (int n : {1000, 100000, 10000000}) {
+        layout_bench_row<LinkedList>("node/value", n);
+        layout_bench_row<UnrolledList>("unrolled", n);
+    }
+}
+
+// Параметры безголового (headless) режима
+struct HeadlessConfig {
+    int seconds = 5;
+    int threads = 4;
+    int read_pct = 80;      // Доля find среди операций, в процентах
+    int keys = 1000;        // Значения берутся из [1, keys]
+    std::string workload;   // Профиль YCSB A-F; пусто - смесь read_pct
+    std::string distribution;   // Пусто - распределение профиля
+};
+
+WorkloadSpec make_workload(const HeadlessConfig& config) {
+    WorkloadSpec spec = config.workload.empty()
+        ? WorkloadSpec::readWrite(config.read_pct, config.keys)
+        : WorkloadSpec::ycsb(config.workload[0], config.keys);
+    if (!config.distribution.empty() && !parseDistribution(config.distribution, spec.distribution)) {
+        throw std::invalid_argument("unknown distribution " + config.distribution);
+    }
+    return spec;
+}
+
+// Счетчики потока на отдельной кэш-линии, чтобы потоки не мешали друг другу
+struct alignas(64) HeadlessCounters {
+    long long ops[WORKLOAD_OP_KINDS] = {};
+    LatencyHistogram latency[WORKLOAD_OP_KINDS];    // Выборочные задержки, нс
+};
+
+// Выполняет одну операцию трассы. Scan идет через range(), если список
+// его поддерживает, иначе сводится к find начального ключа
+template<typename List>
+void apply_op(List& list, const WorkloadOp& op) {
+    switch (op.kind) {
+        case WorkloadOpKind::Find:
+            list.find(op.key);
+            break;
+        case WorkloadOpKind::Insert:
+            list.insert(op.key);
+            break;
+        case WorkloadOpKind::InsertAfter:
+            list.insertAfter(op.arg, op.key);
+            break;
+        case WorkloadOpKind::Remove:
+            list.remove(op.key);
+            break;
+        case WorkloadOpKind::Update:
+            if (list.remove(op.key)) {
+                list.insert(op.key);
+            }
+            break;
+        case WorkloadOpKind::ReadModifyWrite:
+            if (list.find(op.key) && list.remove(op.key)) {
+                list.insert(op.key);
+            }
+            break;
+        case WorkloadOpKind::Scan:
+            if constexpr (requires { list.range(op.key, op.key); }) {
+                list.range(op.key, op.key + op.arg);
+            } else {
+                list.find(op.key);
+            }
+            break;
+    }
+}
+
+// Безголовый режим: без пауз и без вывода во время работы. Каждый поток
+// проигрывает по кругу свою заранее сгенерированную трассу, так что
+// генерация ключей не попадает в замер; новые ключи на каждом проходе
+// свои (opForPass). Задержка измеряется у каждой 8-й операции
+template<typename List>
+void run_headless(const std::string& name, const HeadlessConfig& config) {
+    const int SAMPLE_EVERY = 8;
+    const size_t TRACE_LENGTH = 1 << 20;
+    
+    WorkloadSpec spec = make_workload(config);
+    List list;
+    for (int value : spec.loadKeys()) {
+        list.insert(value);
+    }
+    int initial_size = list.size();
+    
+    std::vector<std::vector<WorkloadOp>> traces;
+    for (int i = 0; i < config.threads; i++) {
+        traces.push_back(generateTrace(spec, TRACE_LENGTH, i, config.threads, 1));
+    }
+    int span = newKeySpan(spec, traces);
+    
+    auto counters = std::make_unique<HeadlessCounters[]>(config.threads);
+    std::atomic<bool> running{true};
+    
+    auto worker = [&](int id) {
+        HeadlessCounters& local = counters[id];
+        const std::vector<WorkloadOp>& trace = traces[id];
+        
+        for (size_t n = 0; running.load(std::memory_order_relaxed); n++) {
+            WorkloadOp op = opForPass(trace[n % TRACE_LENGTH], spec, span, n / TRACE_LENGTH);
+            if (n % SAMPLE_EVERY == 0) {
+                LatencyTimer timer{local.latency[int(op.kind)]};
+                apply_op(list, op);
+            } else {
+                apply_op(list, op);
+            }
+            local.ops[int(op.kind)]++;
+        }
+    };
+    
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < config.threads; i++) {
+        threads.emplace_back(worker, i);
+    }
+    std::this_thread::sleep_for(std::chrono::seconds(config.seconds));
+    running.store(false, std::memory_order_relaxed);
+    for (auto& t : threads) {
+        t.join();
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    
+    long long by_type[WORKLOAD_OP_KINDS] = {};
+    long long total = 0;
+    LatencyHistogram merged[WORKLOAD_OP_KINDS];
+    LatencyHistogram overall;
+    std::cout << "=== Headless " << name << ": " << spec.name << ", " << distributionName(spec.distribution)
+              << " keys 1.." << spec.keys << ", " << config.threads << " threads, "
+              << config.seconds << " s ===" << std::endl;
+    for (int i = 0; i < config.threads; i++) {
+        long long thread_total = 0;
+        for (int op = 0; op < WORKLOAD_OP_KINDS; op++) {
+            by_type[op] += counters[i].ops[op];
+            thread_total += counters[i].ops[op];
+            merged[op].merge(counters[i].latency[op]);
+            overall.merge(counters[i].latency[op]);
+        }
+        total += thread_total;
+        std::cout << "Thread " << i << ": " << thread_total << " ops" << std::endl;
+    }
+    // Точные счетчики всех операций; выборка нужна только для задержек
+    for (int op = 0; op < WORKLOAD_OP_KINDS; op++) {
+        if (by_type[op] > 0) {
+            std::cout << std::left << std::setw(16) << workloadOpName(WorkloadOpKind(op))
+                      << std::right << std::setw(14) << by_type[op] << std::endl;
+        }
+    }
+    std::cout << "List size: " << initial_size << " -> " << list.size() << std::endl;
+    std::cout << "Throughput: " << (long long)(total / elapsed) << " ops/sec" << std::endl;
+    
+    // В гистограммы попадает только каждая 8-я операция
+    std::cout << "Latency (ns, every " << SAMPLE_EVERY << "th op):" << std::endl;
+    print_latency_header("samples");
+    for (int op = 0; op < WORKLOAD_OP_KINDS; op++) {
+        if (by_type[op] > 0) {
+            print_latency_row(workloadOpName(WorkloadOpKind(op)), merged[op]);
+        }
+    }
+    print_latency_row("all", overall);
+}
+
+// Разбор флагов вида --name=value после варианта списка
+HeadlessConfig parse_headless(int argc, char* argv[], int first) {
+    HeadlessConfig config;
+    for (int i = first; i < argc; i++) {
+        std::string arg = argv[i];
+        size_t eq = arg.find('=');
+        if (arg.rfind("--", 0) != 0 || eq == std::string::npos) {
+            throw std::invalid_argument("expected --name=value, got " + arg);
+        }
+        std::string key = arg.substr(2, eq - 2);
+        std::string value = arg.substr(eq + 1);
+        if (key == "seconds") config.seconds = std::stoi(value);
+        else if (key == "threads") config.threads = std::stoi(value);
+        else if (key == "read-pct") config.read_pct = std::stoi(value);
+        else if (key == "keys") config.keys = std::stoi(value);
+        else if (key == "workload") config.workload = value;
+        else if (key == "dist") config.distribution = value;
+        else throw std::invalid_argument("unknown option --" + key);
+    }
+    if (config.seconds < 1 || config.threads < 1 || config.keys < 1 ||
+        config.read_pct < 0 || config.read_pct > 100 || config.workload.size() > 1) {
+        throw std::invalid_argument("option out of range");
+    }
+    return config;
+}
+
+// Длительность замера в секундах из аргумента командной строки
+// (fallback, если аргумента нет); меньше секунды - ошибка
+int parse_seconds(int argc, char* argv[], int index, int fallback) {
+    int seconds = argc > index ? std::stoi(argv[index]) : fallback;
+    if (seconds < 1) {
+        throw std::invalid_argument("seconds must be at least 1");
+    }
+    return seconds;
+}
+
+// Вызывает f.template operator()<List>() для типа списка по имени варианта;
+// false, если вариант неизвестен
+template<typename F>
+bool with_variant(const std::string& variant, F&& f) {
+    if (variant == "coarse") {
+        f.template operator()<LinkedList>();
+    } else if (variant == "fine") {
+        f.template operator()<FineGrainedList>();
+    } else if (variant == "unrolled") {
+        f.template operator()<UnrolledList>();
+    } else if (variant == "lazy") {
+        f.template operator()<LazyList>();
+    } else if (variant == "skiplist") {
+        f.template operator()<ConcurrentSkipList>();
+    } else if (variant == "hashset") {
+        f.template operator()<StripedHashSet>();
+    } else if (variant == "lockfree") {
+        f.template operator()<LockFreeList<EpochReclaimer>>();
+    } else if (variant == "lockfree-hp") {
+        f.template operator()<LockFreeList<HazardReclaimer>>();
+    } else {
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    // Вариант списка: coarse (один shared_mutex), unrolled (узел на кэш-линию),
+    // fine (блокировка на узел),
+    // lazy (блокировки на узлах и поиск без блокировок), skiplist (lazy skip list),
+    // hashset (хеш-множество с разделенными блокировками)
+    // или lockfree / lockfree-hp (упорядоченное множество Harris-Michael
+    // с EBR или hazard pointers). Флаг --check после варианта записывает
+    // историю операций и проверяет ее линеаризуемость в конце теста,
+    // --headless [--seconds=N --threads=N --read-pct=P --keys=N
+    // --workload=A..F --dist=uniform|zipfian|hotspot|sequential|latest]
+    // запускает замер пропускной способности без вывода и пауз
+    std::string variant = argc > 1 ? argv[1] : "coarse";
+    std::string mode = argc > 2 ? argv[2] : "";
+    
     try {
-        ListTester tester;
-        tester.run_test();
+        if (variant == "ebr-stress") {
+            return run_ebr_stress(parse_seconds(argc, argv, 2, 5)) ? 0 : 1;
+        } else if (variant == "bulk-bench") {
+            run_bulk_bench(parse_seconds(argc, argv, 2, 1));
+        } else if (variant == "unrolled-bench") {
+            run_unrolled_bench();
+        } else if (variant == "check") {
+            return run_linearizability_check(argc > 2 ? std::stoi(argv[2]) : 20000) ? 0 : 1;
+        } else if (variant == "reclaim-bench") {
+            run_reclaim_bench(parse_seconds(argc, argv, 2, 3));
+        } else {
+            bool known = with_variant(variant, [&]<typename List>() {
+                if (mode == "--headless") {
+                    run_headless<List>(variant, parse_headless(argc, argv, 3));
+                } else {
+                    run_variant<List>(variant, mode == "--check");
+                }
+            });
+            if (!known) {
+                std::cerr << "Unknown list variant: " << variant << " (expected: coarse, unrolled, fine, lazy, skiplist, hashset, lockfree, lockfree-hp)" << std::endl;
+                return 1;
+            }
+        }
     } catch (const std::exception& e) {
         std::cerr << "Test failed with exception: " << e.what() << std::endl;
         return 1;
@@ -6,12 +6,13 @@
 #include <random>
 #include <fstream>
 #include <mutex>
+#include "LockProfiler.h"
 
 std::ofstream logfile;
-std::mutex log_mutex;
+ProfiledMutex log_mutex{"log_mutex"};
 
 void log(const std::string& message) {
-    std::lock_guard<std::mutex> lock(log_mutex);
+    std::lock_guard lock(log_mutex);
     logfile << message << std::endl;
     std::cout << message << std::endl; 
 }
@@ -0,0 +1,192 @@
+#include "UnrolledList.h"
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+int UnrolledList::Chunk::indexOf(int value) const
+{
+    uint32_t mask = 0;
+#if defined(__SSE2__)
+    // Значения начинаются сразу за заголовком (смещение 12), поэтому
+    // загрузки невыровненные: три сравнения по 4 значения и хвост
+    __m128i key = _mm_set1_epi32(value);
+    int i = 0;
+    for (; i + 4 <= CAPACITY; i += 4)
+    {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+        __m128 eq = _mm_castsi128_ps(_mm_cmpeq_epi32(chunk, key));
+        mask |= uint32_t(_mm_movemask_ps(eq)) << i;
+    }
+    for (; i < CAPACITY; i++)
+    {
+        mask |= uint32_t(values[i] == value) << i;
+    }
+#else
+    for (int i = 0; i < CAPACITY; i++)
+    {
+        mask |= uint32_t(values[i] == value) << i;
+    }
+#endif
+    mask &= (uint32_t(1) << count) - 1;     // Слоты за count не заняты
+    return mask == 0 ? -1 : std::countr_zero(mask);
+}
+
+void UnrolledList::Chunk::insertAt(int index, int value)
+{
+    std::memmove(values + index + 1, values + index, sizeof(int) * (count - index));
+    values[index] = value;
+    count++;
+}
+
+void UnrolledList::Chunk::eraseAt(int index)
+{
+    std::memmove(values + index, values + index + 1, sizeof(int) * (count - index - 1));
+    count--;
+}
+
+UnrolledList::UnrolledList() : head(nullptr) {}
+
+UnrolledList::~UnrolledList()
+{
+    Chunk* current = head;
+    while (current != nullptr)
+    {
+        Chunk* next = current->next;
+        delete current;
+        current = next;
+    }
+}
+
+void UnrolledList::insertLocked(int value)
+{
+    if (head == nullptr || head->count == CAPACITY)
+    {
+        Chunk* chunk = new Chunk();
+        chunk->next = head;
+        head = chunk;
+    }
+    head->insertAt(0, value);
+    total.fetch_add(1, std::memory_order_relaxed);
+}
+
+void UnrolledList::insert(int value)
+{
+    std::unique_lock lock(mtx);
+    insertLocked(value);
+}
+
+void UnrolledList::insertAfter(int targetValue, int newValue)
+{
+    std::unique_lock lock(mtx);
+
+    for (Chunk* current = head; current != nullptr; current = current->next)
+    {
+        int index = current->indexOf(targetValue);
+        if (index < 0)
+        {
+            continue;
+        }
+
+        int position = index + 1;
+        if (current->count == CAPACITY)
+        {
+            // Узел полон - делим его пополам, вторая половина уходит в новый узел
+            Chunk* upper = new Chunk();
+            int half = CAPACITY / 2;
+            std::memcpy(upper->values, current->values + half, sizeof(int) * (CAPACITY - half));
+            upper->count = CAPACITY - half;
+            current->count = half;
+            upper->next = current->next;
+            current->next = upper;
+
+            if (position > half)
+            {
+                current = upper;
+                position -= half;
+            }
+        }
+        current->insertAt(position, newValue);
+        total.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // Если target не найден, вставляем в начало
+    insertLocked(newValue);
+}
+
+bool UnrolledList::remove(int value)
+{
+    std::unique_lock lock(mtx);
+
+    Chunk* prev = nullptr;
+    for (Chunk* current = head; current != nullptr; prev = current, current = current->next)
+    {
+        int index = current->indexOf(value);
+        if (index < 0)
+        {
+            continue;
+        }
+
+        current->eraseAt(index);
+        total.fetch_sub(1, std::memory_order_relaxed);
+        if (current->count == 0)
+        {
+            (prev == nullptr ? head : prev->next) = current->next;
+            delete current;
+        }
+        return true;
+    }
+    return false;
+}
+
+bool UnrolledList::find(int value)
+{
+    std::shared_lock lock(mtx);
+
+    for (Chunk* current = head; current != nullptr; current = current->next)
+    {
+        if (current->indexOf(value) >= 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void UnrolledList::print() const
+{
+    std::shared_lock lock(mtx);
+
+    std::cout << "List: ";
+    bool first = true;
+    for (Chunk* current = head; current != nullptr; current = current->next)
+    {
+        for (int i = 0; i < current->count; i++)
+        {
+            if (!first)
+            {
+                std::cout << " -> ";
+            }
+            std::cout << current->values[i];
+            first = false;
+        }
+    }
+    std::cout << " -> NULL" << std::endl;
+}
+
+int UnrolledList::size() const
+{
+    return total.load(std::memory_order_relaxed);
+}
+
+bool UnrolledList::empty() const
+{
+    std::shared_lock lock(mtx);
+    return head == nullptr;
+}
@@ -0,0 +1,60 @@
+#ifndef UNROLLEDLIST_H
+#define UNROLLEDLIST_H
+
+#include <atomic>
+#include <shared_mutex>
+#include "NodePool.h"
+#include "LockProfiler.h"
+
+// Развернутый (unrolled) вариант LinkedList: узел хранит не одно значение,
+// а массив значений и их количество, и весь узел занимает одну кэш-линию. Порядок элементов и
+// семантика операций те же, что у LinkedList (повторы разрешены, insert
+// добавляет в начало, remove удаляет первое вхождение), но обход читает
+// память подряд, а значения внутри узла сравниваются SIMD-инструкциями.
+class UnrolledList
+{
+public:
+    static constexpr int CAPACITY = 13;        // 8 (next) + 4 (count) + 13 * 4 = 64 байта
+
+private:
+    struct alignas(64) Chunk
+    {
+        Chunk* next = nullptr;
+        int count = 0;
+        int values[CAPACITY] = {};
+
+        static void* operator new(size_t) { return NodePool<Chunk>::allocate(); }
+        static void operator delete(void* ptr) { NodePool<Chunk>::deallocate(ptr); }
+
+        // Индекс первого вхождения value или -1. Весь узел сравнивается
+        // сразу (SSE2, если доступно), без раннего выхода
+        int indexOf(int value) const;
+        void insertAt(int index, int value);
+        void eraseAt(int index);
+    };
+    static_assert(sizeof(Chunk) == 64, "Chunk must fit in one cache line");
+
+    Chunk* head;
+    std::atomic<int> total{0};
+    mutable ProfiledSharedMutex mtx{"UnrolledList::mtx"};
+
+    void insertLocked(int value);              // Вставка в начало, mtx уже захвачен
+
+public:
+    UnrolledList();
+    ~UnrolledList();
+
+    UnrolledList(const UnrolledList&) = delete;
+    UnrolledList& operator=(const UnrolledList&) = delete;
+
+    void insert(int value);                    // Вставка в начало
+    void insertAfter(int targetValue, int newValue); // Вставка после target
+    bool remove(int value);                    // Удаление по значению
+    bool find(int value);                      // Поиск элемента
+
+    void print() const;                        // Вывод списка
+    int size() const;                          // Размер списка
+    bool empty() const;                        // Проверка на пустоту
+};
+
+#endif
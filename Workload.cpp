@@ -0,0 +1,273 @@
+#include "Workload.h"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <stdexcept>
+
+namespace
+{
+
+uint32_t scramble(uint32_t h)
+{
+    h ^= h >> 16;
+    h *= 0x85EBCA6B;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35;
+    h ^= h >> 16;
+    return h;
+}
+
+}
+
+WorkloadSpec WorkloadSpec::ycsb(char profile, int keys)
+{
+    WorkloadSpec spec;
+    spec.name = std::string("YCSB-") + profile;
+    spec.keys = keys;
+    spec.distribution = KeyDistribution::Zipfian;
+
+    int* w = spec.weights;
+    switch (profile)
+    {
+    case 'A':
+        w[int(WorkloadOpKind::Find)] = 50;
+        w[int(WorkloadOpKind::Update)] = 50;
+        break;
+    case 'B':
+        w[int(WorkloadOpKind::Find)] = 95;
+        w[int(WorkloadOpKind::Update)] = 5;
+        break;
+    case 'C':
+        w[int(WorkloadOpKind::Find)] = 100;
+        break;
+    case 'D':
+        w[int(WorkloadOpKind::Find)] = 95;
+        w[int(WorkloadOpKind::Insert)] = 5;
+        spec.distribution = KeyDistribution::Latest;
+        spec.insertsNewKeys = true;
+        break;
+    case 'E':
+        w[int(WorkloadOpKind::Scan)] = 95;
+        w[int(WorkloadOpKind::Insert)] = 5;
+        spec.insertsNewKeys = true;
+        break;
+    case 'F':
+        w[int(WorkloadOpKind::Find)] = 50;
+        w[int(WorkloadOpKind::ReadModifyWrite)] = 50;
+        break;
+    default:
+        throw std::invalid_argument(std::string("unknown YCSB profile ") + profile);
+    }
+    return spec;
+}
+
+WorkloadSpec WorkloadSpec::readWrite(int readPct, int keys)
+{
+    WorkloadSpec spec;
+    spec.name = std::to_string(readPct) + "% reads";
+    spec.keys = keys;
+    spec.loadStep = 2;
+
+    int writePct = 100 - readPct;
+    spec.weights[int(WorkloadOpKind::Find)] = 4 * readPct;
+    spec.weights[int(WorkloadOpKind::Insert)] = writePct;
+    spec.weights[int(WorkloadOpKind::InsertAfter)] = writePct;
+    spec.weights[int(WorkloadOpKind::Remove)] = 2 * writePct;
+    return spec;
+}
+
+std::vector<int> WorkloadSpec::loadKeys() const
+{
+    std::vector<int> values;
+    for (int key = loadStep; key <= keys; key += loadStep)
+    {
+        values.push_back(key);
+    }
+    return values;
+}
+
+KeyGenerator::KeyGenerator(KeyDistribution dist, int keyCount, double zipfTheta,
+                           double hotKeys, double hotOps, int start)
+    : distribution(dist), keys(keyCount), theta(zipfTheta),
+      hotKeyFraction(hotKeys), hotOpFraction(hotOps), sequence(start % keyCount)
+{
+    if (distribution == KeyDistribution::Zipfian || distribution == KeyDistribution::Latest)
+    {
+        for (int i = 1; i <= keys; i++)
+        {
+            zetan += 1.0 / std::pow(double(i), theta);
+        }
+        double zeta2 = 1.0 + 1.0 / std::pow(2.0, theta);
+        alpha = 1.0 / (1.0 - theta);
+        eta = (1.0 - std::pow(2.0 / keys, 1.0 - theta)) / (1.0 - zeta2 / zetan);
+    }
+}
+
+int KeyGenerator::zipfRank(std::mt19937_64& gen)
+{
+    double u = std::uniform_real_distribution<double>(0.0, 1.0)(gen);
+    double uz = u * zetan;
+    if (uz < 1.0)
+    {
+        return 0;
+    }
+    if (uz < 1.0 + std::pow(0.5, theta))
+    {
+        return 1;
+    }
+    int rank = int(keys * std::pow(eta * u - eta + 1.0, alpha));
+    return rank < keys ? rank : keys - 1;
+}
+
+int KeyGenerator::next(std::mt19937_64& gen, int latest)
+{
+    switch (distribution)
+    {
+    case KeyDistribution::Uniform:
+        return std::uniform_int_distribution<int>(1, keys)(gen);
+    case KeyDistribution::Zipfian:
+        // Без перемешивания горячими были бы наименьшие ключи, а они
+        // в упорядоченных списках лежат в самом начале
+        return 1 + int(scramble(uint32_t(zipfRank(gen))) % uint32_t(keys));
+    case KeyDistribution::Hotspot:
+    {
+        int hot = std::max(1, int(keys * hotKeyFraction));
+        double u = std::uniform_real_distribution<double>(0.0, 1.0)(gen);
+        if (u < hotOpFraction || hot == keys)
+        {
+            return std::uniform_int_distribution<int>(1, hot)(gen);
+        }
+        return std::uniform_int_distribution<int>(hot + 1, keys)(gen);
+    }
+    case KeyDistribution::Sequential:
+        sequence = sequence % keys + 1;
+        return sequence;
+    case KeyDistribution::Latest:
+    {
+        int key = latest - zipfRank(gen);
+        return key >= 1 ? key : 1;
+    }
+    }
+    return 1;
+}
+
+std::vector<WorkloadOp> generateTrace(const WorkloadSpec& spec, size_t length,
+                                      int thread, int threads, uint64_t seed)
+{
+    std::mt19937_64 gen(seed * 1000003 + thread);
+    std::discrete_distribution<int> kindDis(std::begin(spec.weights), std::end(spec.weights));
+    std::uniform_int_distribution<int> scanDis(1, spec.maxScanLength);
+    KeyGenerator generator(spec.distribution, spec.keys, spec.zipfTheta,
+                           spec.hotKeyFraction, spec.hotOpFraction,
+                           thread * (spec.keys / threads));
+
+    int latest = spec.keys;
+    int inserted = 0;
+    std::vector<WorkloadOp> trace;
+    trace.reserve(length);
+    for (size_t i = 0; i < length; i++)
+    {
+        WorkloadOp op{static_cast<WorkloadOpKind>(kindDis(gen)), 0, 0};
+        if (op.kind == WorkloadOpKind::Insert && spec.insertsNewKeys)
+        {
+            // Новые ключи потоков чередуются: keys + 1 + thread, + threads, ...
+            op.key = spec.keys + 1 + inserted * threads + thread;
+            latest = op.key;
+            inserted++;
+        }
+        else
+        {
+            op.key = generator.next(gen, latest);
+        }
+
+        if (op.kind == WorkloadOpKind::InsertAfter)
+        {
+            op.arg = generator.next(gen, latest);
+        }
+        else if (op.kind == WorkloadOpKind::Scan)
+        {
+            op.arg = scanDis(gen);
+        }
+        trace.push_back(op);
+    }
+    return trace;
+}
+
+int newKeySpan(const WorkloadSpec& spec, const std::vector<std::vector<WorkloadOp>>& traces)
+{
+    int maxKey = spec.keys;
+    for (const auto& trace : traces)
+    {
+        for (const WorkloadOp& op : trace)
+        {
+            maxKey = std::max(maxKey, op.key);
+            if (op.kind == WorkloadOpKind::InsertAfter)
+            {
+                maxKey = std::max(maxKey, op.arg);
+            }
+        }
+    }
+    return maxKey - spec.keys;
+}
+
+WorkloadOp opForPass(const WorkloadOp& op, const WorkloadSpec& spec, int span, size_t pass)
+{
+    if (span == 0 || pass == 0)
+    {
+        return op;
+    }
+    int shift = static_cast<int>(int64_t(span) * int64_t(pass));
+    WorkloadOp shifted = op;
+    if (shifted.key > spec.keys)
+    {
+        shifted.key += shift;
+    }
+    if (shifted.kind == WorkloadOpKind::InsertAfter && shifted.arg > spec.keys)
+    {
+        shifted.arg += shift;
+    }
+    return shifted;
+}
+
+const char* workloadOpName(WorkloadOpKind kind)
+{
+    switch (kind)
+    {
+    case WorkloadOpKind::Find: return "find";
+    case WorkloadOpKind::Insert: return "insert";
+    case WorkloadOpKind::InsertAfter: return "insertAfter";
+    case WorkloadOpKind::Remove: return "remove";
+    case WorkloadOpKind::Update: return "update";
+    case WorkloadOpKind::ReadModifyWrite: return "readModifyWrite";
+    case WorkloadOpKind::Scan: return "scan";
+    }
+    return "?";
+}
+
+const char* distributionName(KeyDistribution distribution)
+{
+    switch (distribution)
+    {
+    case KeyDistribution::Uniform: return "uniform";
+    case KeyDistribution::Zipfian: return "zipfian";
+    case KeyDistribution::Hotspot: return "hotspot";
+    case KeyDistribution::Sequential: return "sequential";
+    case KeyDistribution::Latest: return "latest";
+    }
+    return "?";
+}
+
+bool parseDistribution(const std::string& name, KeyDistribution& distribution)
+{
+    for (KeyDistribution candidate : {KeyDistribution::Uniform, KeyDistribution::Zipfian,
+                                      KeyDistribution::Hotspot, KeyDistribution::Sequential,
+                                      KeyDistribution::Latest})
+    {
+        if (name == distributionName(candidate))
+        {
+            distribution = candidate;
+            return true;
+        }
+    }
+    return false;
+}
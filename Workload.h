@@ -0,0 +1,110 @@
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+// Распределение ключей в нагрузке
+enum class KeyDistribution
+{
+    Uniform,        // Равномерно по всем ключам
+    Zipfian,        // Zipf с параметром theta, горячие ключи разбросаны хешем
+    Hotspot,        // hotOpFraction обращений к доле hotKeyFraction ключей
+    Sequential,     // Ключи по кругу один за другим
+    Latest          // Zipf по давности: чаще всего - последние вставленные
+};
+
+enum class WorkloadOpKind : uint8_t
+{
+    Find,
+    Insert,
+    InsertAfter,
+    Remove,
+    Update,             // remove, и если ключ был - insert того же ключа
+    ReadModifyWrite,    // find, затем update, если ключ найден
+    Scan                // Диапазон [key, key + arg]
+};
+
+constexpr int WORKLOAD_OP_KINDS = 7;
+
+struct WorkloadOp
+{
+    WorkloadOpKind kind;
+    int key;
+    int arg;            // target для InsertAfter, длина для Scan
+};
+
+// Описание нагрузки: веса операций, распределение ключей и загрузка
+struct WorkloadSpec
+{
+    std::string name;
+    int weights[WORKLOAD_OP_KINDS] = {};   // Относительные веса видов операций
+    KeyDistribution distribution = KeyDistribution::Uniform;
+    int keys = 1000;                        // Ключи [1, keys]
+    int loadStep = 1;                       // Перед запуском загружаются 1, 1 + step, ...
+    bool insertsNewKeys = false;            // Insert добавляет ключи за пределами keys
+    double zipfTheta = 0.99;
+    double hotKeyFraction = 0.2;
+    double hotOpFraction = 0.8;
+    int maxScanLength = 100;
+
+    // Профили в духе YCSB A-F:
+    // A - 50% чтений, 50% обновлений; B - 95/5; C - только чтения;
+    // D - 95% чтений последних ключей, 5% вставок новых;
+    // E - 95% коротких сканов, 5% вставок; F - 50% чтений, 50% read-modify-write
+    static WorkloadSpec ycsb(char profile, int keys);
+
+    // Смесь старого ListTester: readPct процентов find, запись делится
+    // на insert, insertAfter (по четверти) и remove (половина)
+    static WorkloadSpec readWrite(int readPct, int keys);
+
+    std::vector<int> loadKeys() const;
+};
+
+// Генератор ключей одного потока
+class KeyGenerator
+{
+private:
+    KeyDistribution distribution;
+    int keys;
+    double theta;
+    double hotKeyFraction;
+    double hotOpFraction;
+    int sequence;
+
+    // Параметры генератора Zipf (Gray и др., "Quickly generating
+    // billion-record synthetic databases")
+    double zetan = 0;
+    double alpha = 0;
+    double eta = 0;
+
+    int zipfRank(std::mt19937_64& gen);     // Ранг в [0, keys), 0 - самый частый
+
+public:
+    KeyGenerator(KeyDistribution distribution, int keys, double theta,
+                 double hotKeyFraction, double hotOpFraction, int start = 0);
+
+    // latest - последний вставленный ключ, нужен только для Latest
+    int next(std::mt19937_64& gen, int latest);
+};
+
+// Заранее сгенерированная трасса операций для потока thread из threads.
+// Новые ключи Insert при insertsNewKeys у разных потоков не пересекаются
+std::vector<WorkloadOp> generateTrace(const WorkloadSpec& spec, size_t length,
+                                      int thread, int threads, uint64_t seed);
+
+// Трасса проигрывается по кругу. Чтобы на повторных проходах Insert
+// снова добавлял новые ключи, а не уже вставленные, ключи сверх spec.keys
+// сдвигаются на pass * span, где span - сколько новых ключей занимает
+// один проход всех трасс (0, если новых ключей нет)
+int newKeySpan(const WorkloadSpec& spec, const std::vector<std::vector<WorkloadOp>>& traces);
+WorkloadOp opForPass(const WorkloadOp& op, const WorkloadSpec& spec, int span, size_t pass);
+
+const char* workloadOpName(WorkloadOpKind kind);
+const char* distributionName(KeyDistribution distribution);
+bool parseDistribution(const std::string& name, KeyDistribution& distribution);
+
+#endif